@@ -0,0 +1,316 @@
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/htup_details.h"
+#include "catalog/namespace.h"
+#include "catalog/pg_type.h"
+#include "commands/trigger.h"
+#include "executor/spi.h"
+#include "lib/stringinfo.h"
+#include "utils/builtins.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/syscache.h"
+
+#include "coldecision.h"
+
+/*
+Per-backend cache of pg_chardetect_column_encoding, the table of columns
+whose encoding is known, e.g. from a charset_profile() run:
+
+    INSERT INTO pg_chardetect_column_encoding (relid, attname, encoding)
+        VALUES ('test', 'convert_this', 'windows-1252');
+
+The conversion triggers, the pg_chardetect_convert_table() workers and
+convert_to_UTF8(text, regclass, name, boolean) convert those columns from
+the known encoding, or leave them alone if the policy is 'skip', and only
+run detection for columns without a decision.
+
+The decisions of a relation are read with one query the first time they
+are needed and kept in a hash table keyed by relation OID, in a memory
+context under CacheMemoryContext.  Like the relcache, the cache relies on
+invalidation messages: a trigger on pg_chardetect_column_encoding sends a
+relcache invalidation for every relation whose decisions change, which
+reaches all backends at commit, and a relcache callback drops the
+relation's entry.  Invalidating the decision table itself, or everything,
+empties the cache.
+*/
+
+#define DECISION_TABLE "pg_chardetect_column_encoding"
+// schema pg_chardetect.sql creates the table in, whatever the search path
+#define DECISION_SCHEMA "public"
+
+typedef struct RelationDecisions
+{
+    Oid             relid;          // hash key, must be first
+    int             ndecisions;
+    AttrNumber      *attnums;
+    ColumnDecision  *decisions;
+} RelationDecisions;
+
+static MemoryContext decision_context = NULL;
+static HTAB *decision_cache = NULL;
+// pg_chardetect_column_encoding when decisions were last read
+static Oid decision_table = InvalidOid;
+static bool callback_registered = false;
+// bumped by every invalidation, to notice those arriving during a read
+static uint64 decision_inval_count = 0;
+
+// Forward declarations
+
+PG_FUNCTION_INFO_V1(pg_chardetect_column_encoding_invalidate);
+
+void        decision_cache_init(void);
+void        decision_cache_reset(void);
+void        decision_cache_callback(Datum arg, Oid relid);
+RelationDecisions* decision_cache_load(Oid relid);
+int         decision_cache_read(Oid relid, AttrNumber** attnums, ColumnDecision** decisions);
+void        decision_invalidate_tuple(Relation relation, HeapTuple tuple);
+
+void
+decision_cache_init(void)
+{
+    HASHCTL ctl;
+
+    decision_context = AllocSetContextCreate(CacheMemoryContext,
+                                             "pg_chardetect column decisions",
+                                             ALLOCSET_SMALL_SIZES);
+
+    memset(&ctl, 0, sizeof(ctl));
+    ctl.keysize = sizeof(Oid);
+    ctl.entrysize = sizeof(RelationDecisions);
+    ctl.hcxt = decision_context;
+
+    decision_cache = hash_create("pg_chardetect column decisions", 64, &ctl,
+                                 HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
+
+void
+decision_cache_reset(void)
+{
+    // the hash table lives in decision_context too
+    if (NULL != decision_context)
+        MemoryContextDelete(decision_context);
+
+    decision_context = NULL;
+    decision_cache = NULL;
+}
+
+void
+decision_cache_callback(Datum arg, Oid relid)
+{
+    RelationDecisions* entry;
+
+    decision_inval_count++;
+
+    if (NULL == decision_cache)
+        return;
+
+    if (InvalidOid == relid || relid == decision_table)
+    {
+        decision_cache_reset();
+        return;
+    }
+
+    entry = (RelationDecisions *) hash_search(decision_cache, &relid, HASH_FIND, NULL);
+
+    if (NULL != entry)
+    {
+        pfree(entry->attnums);
+        pfree(entry->decisions);
+        hash_search(decision_cache, &relid, HASH_REMOVE, NULL);
+    }
+}
+
+/*
+Reads the decisions for relid into arrays allocated in CurrentMemoryContext
+and returns how many there are.  Decisions for columns that no longer
+exist are ignored.
+*/
+int
+decision_cache_read(Oid relid, AttrNumber** attnums, ColumnDecision** decisions)
+{
+    StringInfoData query;
+    Oid         argtypes[1] = {REGCLASSOID};
+    Datum       values[1];
+    Oid         nspid;
+    int         ndecisions = 0;
+    uint64      row;
+    int         ret;
+
+    *attnums = NULL;
+    *decisions = NULL;
+
+    nspid = get_namespace_oid(DECISION_SCHEMA, true);
+    decision_table = OidIsValid(nspid) ? get_relname_relid(DECISION_TABLE, nspid) : InvalidOid;
+    if (InvalidOid == decision_table)
+        return 0;
+
+    initStringInfo(&query);
+    appendStringInfo(&query, "SELECT attname, encoding, policy FROM %s WHERE relid = $1",
+                     quote_qualified_identifier(DECISION_SCHEMA, DECISION_TABLE));
+    values[0] = ObjectIdGetDatum(relid);
+
+    if (SPI_connect() != SPI_OK_CONNECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect: SPI_connect failed")));
+
+    ret = SPI_execute_with_args(query.data, 1, argtypes, values, NULL, true, 0);
+    if (ret != SPI_OK_SELECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect: reading %s failed: %s", DECISION_TABLE, SPI_result_code_string(ret))));
+
+    // SPI_palloc allocates in the caller's context
+    *attnums = SPI_palloc(Max(SPI_processed, 1) * sizeof(AttrNumber));
+    *decisions = SPI_palloc(Max(SPI_processed, 1) * sizeof(ColumnDecision));
+
+    for (row = 0; row < SPI_processed; row++)
+    {
+        HeapTuple   tuple = SPI_tuptable->vals[row];
+        TupleDesc   tupdesc = SPI_tuptable->tupdesc;
+        char        *attname = SPI_getvalue(tuple, tupdesc, 1);
+        char        *encoding = SPI_getvalue(tuple, tupdesc, 2);
+        char        *policy = SPI_getvalue(tuple, tupdesc, 3);
+        AttrNumber  attnum = get_attnum(relid, attname);
+
+        if (InvalidAttrNumber == attnum || NULL == encoding || NULL == policy)
+            continue;
+
+        (*attnums)[ndecisions] = attnum;
+        (*decisions)[ndecisions].policy = (0 == strcmp(policy, "skip")) ? COLUMN_SKIP : COLUMN_CONVERT;
+        strlcpy((*decisions)[ndecisions].encoding, encoding, NAMEDATALEN);
+        ndecisions++;
+    }
+
+    SPI_finish();
+
+    return ndecisions;
+}
+
+RelationDecisions*
+decision_cache_load(Oid relid)
+{
+    RelationDecisions* entry;
+    AttrNumber* attnums;
+    ColumnDecision* decisions;
+    uint64 inval_count;
+    int ndecisions;
+
+    if (!callback_registered)
+    {
+        CacheRegisterRelcacheCallback(decision_cache_callback, (Datum) 0);
+        callback_registered = true;
+    }
+
+    // read again if the decisions were invalidated while reading them
+    do
+    {
+        inval_count = decision_inval_count;
+        ndecisions = decision_cache_read(relid, &attnums, &decisions);
+    } while (inval_count != decision_inval_count);
+
+    if (NULL == decision_cache)
+        decision_cache_init();
+
+    entry = (RelationDecisions *) hash_search(decision_cache, &relid, HASH_ENTER, NULL);
+    entry->ndecisions = ndecisions;
+    entry->attnums = MemoryContextAlloc(decision_context, Max(ndecisions, 1) * sizeof(AttrNumber));
+    entry->decisions = MemoryContextAlloc(decision_context, Max(ndecisions, 1) * sizeof(ColumnDecision));
+
+    if (ndecisions > 0)
+    {
+        memcpy(entry->attnums, attnums, ndecisions * sizeof(AttrNumber));
+        memcpy(entry->decisions, decisions, ndecisions * sizeof(ColumnDecision));
+    }
+
+    if (NULL != attnums)
+        pfree(attnums);
+    if (NULL != decisions)
+        pfree(decisions);
+
+    return entry;
+}
+
+void
+column_decision_lookup(Oid relid, AttrNumber attnum, ColumnDecision* decision)
+{
+    RelationDecisions* entry = NULL;
+    int i;
+
+    decision->policy = COLUMN_DETECT;
+    decision->encoding[0] = '\0';
+
+    if (NULL != decision_cache)
+        entry = (RelationDecisions *) hash_search(decision_cache, &relid, HASH_FIND, NULL);
+
+    if (NULL == entry)
+        entry = decision_cache_load(relid);
+
+    for (i = 0; i < entry->ndecisions; i++)
+    {
+        if (entry->attnums[i] == attnum)
+        {
+            *decision = entry->decisions[i];
+            return;
+        }
+    }
+}
+
+/*
+Sends a relcache invalidation for the relation a row of the decision table
+refers to, if it still exists.
+*/
+void
+decision_invalidate_tuple(Relation relation, HeapTuple tuple)
+{
+    int     attnum = SPI_fnumber(RelationGetDescr(relation), "relid");
+    bool    isnull;
+    Datum   relid;
+
+    if (attnum <= 0)
+        return;
+
+    relid = heap_getattr(tuple, attnum, RelationGetDescr(relation), &isnull);
+
+    if (!isnull && SearchSysCacheExists1(RELOID, relid))
+        CacheInvalidateRelcacheByRelid(DatumGetObjectId(relid));
+}
+
+/*
+pg_chardetect_column_encoding_invalidate() trigger:
+    - AFTER INSERT OR UPDATE OR DELETE row trigger, and AFTER TRUNCATE
+      statement trigger, on pg_chardetect_column_encoding
+    - makes every backend read the changed decisions again
+*/
+Datum
+pg_chardetect_column_encoding_invalidate(PG_FUNCTION_ARGS)
+{
+    TriggerData *trigdata = (TriggerData *) fcinfo->context;
+
+    if (!CALLED_AS_TRIGGER(fcinfo))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_column_encoding_invalidate: not called by trigger manager")));
+
+    if (TRIGGER_FIRED_BY_TRUNCATE(trigdata->tg_event))
+    {
+        CacheInvalidateRelcacheAll();
+        return PointerGetDatum(NULL);
+    }
+
+    if (!TRIGGER_FIRED_FOR_ROW(trigdata->tg_event))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_column_encoding_invalidate: must be fired for each row, or for TRUNCATE")));
+
+    decision_invalidate_tuple(trigdata->tg_relation, trigdata->tg_trigtuple);
+
+    if (TRIGGER_FIRED_BY_UPDATE(trigdata->tg_event))
+        decision_invalidate_tuple(trigdata->tg_relation, trigdata->tg_newtuple);
+
+    return PointerGetDatum(NULL);
+}
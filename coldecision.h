@@ -0,0 +1,30 @@
+#ifndef _COLDECISION
+#define _COLDECISION
+
+#include "postgres.h"
+#include "fmgr.h"
+#include "access/attnum.h"
+
+// what to do with the values of a column
+typedef enum
+{
+    COLUMN_DETECT,      // no decision: detect each value
+    COLUMN_CONVERT,     // convert from the known encoding without detection
+    COLUMN_SKIP         // leave the values alone
+} ColumnPolicy;
+
+// a column's row in pg_chardetect_column_encoding
+typedef struct ColumnDecision
+{
+    ColumnPolicy    policy;
+    char            encoding[NAMEDATALEN];
+} ColumnDecision;
+
+// looks up the decision for column attnum of relid, COLUMN_DETECT if there
+// is none; decisions are read once per relation and kept until the table's
+// invalidation trigger or a relcache invalidation discards them
+void        column_decision_lookup(Oid relid, AttrNumber attnum, ColumnDecision* decision);
+
+Datum       pg_chardetect_column_encoding_invalidate(PG_FUNCTION_ARGS);
+
+#endif
@@ -4,6 +4,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdbool.h>
 
 #define DEBUG_TMI 0  /* set to 1 for Too Much Information (TMI) */
 
@@ -15,7 +16,7 @@ U_CAPI ToUFLAGContext* U_EXPORT2  flagCB_toU_openContext()
 
     ctx->subCallback = NULL;
     ctx->subContext  = NULL;
-    ctx->flag        = FALSE;
+    ctx->flag        = false;
 
     return ctx;
 }
@@ -28,7 +29,7 @@ U_CAPI FromUFLAGContext* U_EXPORT2  flagCB_fromU_openContext()
 
     ctx->subCallback = NULL;
     ctx->subContext  = NULL;
-    ctx->flag        = FALSE;
+    ctx->flag        = false;
 
     return ctx;
 }
@@ -47,7 +48,7 @@ U_CAPI void U_EXPORT2 flagCB_toU(
         (UCNV_ILLEGAL    == reason) ||
         (UCNV_IRREGULAR  == reason)
        )
-            ((ToUFLAGContext*) context)->flag = TRUE;
+            ((ToUFLAGContext*) context)->flag = true;
 
     if (UCNV_CLONE == reason)
     {
@@ -146,7 +147,7 @@ U_CAPI void U_EXPORT2 flagCB_fromU(
         (UCNV_ILLEGAL    == reason) ||
         (UCNV_IRREGULAR  == reason)
        )
-        ((FromUFLAGContext*) context)->flag = TRUE;
+        ((FromUFLAGContext*) context)->flag = true;
 
     if (reason == UCNV_CLONE)
     {
@@ -0,0 +1,163 @@
+/*
+gen_sbcs_tables
+
+Writes sbcs_tables.c, the byte to UTF-8 tables used by sbcs.c, by asking ICU
+how it converts each byte of each single byte charset its detector can
+report.  The tables reproduce ICU's own output, including what its default
+callback substitutes for unassigned bytes and which bytes the flagging
+callback in flagcb.c reports in force mode.
+
+    make sbcs-tables
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "unicode/ucnv.h"
+#include "unicode/ustring.h"
+#include "unicode/uversion.h"
+
+#include "flagcb.h"
+
+static const char* charsets[] =
+{
+    "ISO-8859-1",
+    "ISO-8859-2",
+    "ISO-8859-5",
+    "ISO-8859-6",
+    "ISO-8859-7",
+    "ISO-8859-8",
+    "ISO-8859-8-I",
+    "ISO-8859-9",
+    "windows-1250",
+    "windows-1251",
+    "windows-1252",
+    "windows-1253",
+    "windows-1254",
+    "windows-1255",
+    "windows-1256",
+    "KOI8-R",
+    NULL
+};
+
+static void
+fail(const char* charset, const char* what, UErrorCode status)
+{
+    fprintf(stderr, "gen_sbcs_tables: %s: %s: %s\n", charset, what, u_errorName(status));
+    exit(1);
+}
+
+int
+main(void)
+{
+    char version[U_MAX_VERSION_STRING_LENGTH];
+    UVersionInfo info;
+    int c;
+
+    u_getVersion(info);
+    u_versionToString(info, version);
+
+    printf("/*\n");
+    printf("Byte to UTF-8 tables for single byte charsets.\n\n");
+    printf("Generated by gen_sbcs_tables from ICU %s - do not edit.\n", version);
+    printf("*/\n\n");
+    printf("#include \"sbcs.h\"\n");
+
+    for (c = 0; NULL != charsets[c]; c++)
+    {
+        const char* charset = charsets[c];
+        UErrorCode status = U_ZERO_ERROR;
+        UConverter* conv;
+        UConverter* flagging;
+        ToUFLAGContext* context;
+        unsigned char flagged[32];
+        char ident[64];
+        int b;
+        int i;
+
+        conv = ucnv_open(charset, &status);
+        if (U_FAILURE(status))
+            fail(charset, "open", status);
+
+        // a second converter, set up the way pg_chardetect does in force mode
+        flagging = ucnv_open(charset, &status);
+        ucnv_setToUCallBack(flagging, UCNV_TO_U_CALLBACK_SKIP, NULL, NULL, NULL, &status);
+        context = flagCB_toU_openContext();
+        ucnv_setToUCallBack(flagging, flagCB_toU, context,
+                            &(context->subCallback), &(context->subContext), &status);
+        if (U_FAILURE(status))
+            fail(charset, "set callback", status);
+
+        for (i = 0; charset[i] && i < (int) sizeof(ident) - 1; i++)
+            ident[i] = (charset[i] == '-') ? '_' : charset[i];
+        ident[i] = '\0';
+
+        memset(flagged, 0, sizeof(flagged));
+
+        printf("\nstatic const SbcsChar %s_map[256] =\n{\n", ident);
+
+        for (b = 0; b < 256; b++)
+        {
+            char out[8];
+            UChar u[4];
+            char in = (char) b;
+            int32_t ulen;
+            int32_t len;
+
+            // default callbacks, as convert_to_UTF8 without force
+            ulen = ucnv_toUChars(conv, u, 4, &in, 1, &status);
+            u_strToUTF8(out, sizeof(out), &len, u, ulen, &status);
+            if (U_FAILURE(status))
+                fail(charset, "convert", status);
+            ucnv_reset(conv);
+
+            if (len > 3)
+                fail(charset, "more than 3 UTF-8 bytes", U_INTERNAL_PROGRAM_ERROR);
+            if (b < 0x80 && (len != 1 || (unsigned char) out[0] != b))
+                fail(charset, "ASCII is not mapped to itself", U_INTERNAL_PROGRAM_ERROR);
+
+            printf("    { %d, { 0x%02X, 0x%02X, 0x%02X } },\n",
+                   len,
+                   len > 0 ? (unsigned char) out[0] : 0,
+                   len > 1 ? (unsigned char) out[1] : 0,
+                   len > 2 ? (unsigned char) out[2] : 0);
+
+            // force mode: does the flagging callback fire?
+            context->flag = false;
+            ucnv_toUChars(flagging, u, 4, &in, 1, &status);
+            if (U_FAILURE(status))
+                fail(charset, "toUChars (force)", status);
+            ucnv_reset(flagging);
+
+            if (context->flag)
+                flagged[b / 8] |= (unsigned char) (1 << (b % 8));
+        }
+
+        printf("};\n\nstatic const unsigned char %s_flagged[32] =\n{\n   ", ident);
+        for (i = 0; i < 32; i++)
+            printf(" 0x%02X,%s", flagged[i], (i % 8 == 7 && i < 31) ? "\n   " : "");
+        printf("\n};\n");
+
+        ucnv_close(flagging);
+        ucnv_close(conv);
+    }
+
+    printf("\nconst SbcsCharset sbcs_charsets[] =\n{\n");
+    for (c = 0; NULL != charsets[c]; c++)
+    {
+        char ident[64];
+        int i;
+
+        for (i = 0; charsets[c][i] && i < (int) sizeof(ident) - 1; i++)
+            ident[i] = (charsets[c][i] == '-') ? '_' : charsets[c][i];
+        ident[i] = '\0';
+
+        printf("    { \"%s\", %s_map, %s_flagged },\n", charsets[c], ident, ident);
+    }
+    printf("    { NULL, NULL, NULL }\n};\n");
+
+    return 0;
+}
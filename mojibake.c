@@ -0,0 +1,168 @@
+#include "mojibake.h"
+#include "sbcs.h"
+#include "utf8scan.h"
+#include <string.h>
+
+/*
+Detection and repair of double encoded UTF-8 ("mojibake").
+
+UTF-8 that was decoded as windows-1252 or latin1 and encoded again turns
+every byte of a multibyte sequence into a character of its own: the lead
+byte 0xC2 to 0xF4 into U+00C2 to U+00F4, each continuation byte 0x80 to
+0xBF into U+0080 to U+00BF or one of the windows-1252 characters at 0x80
+to 0x9F.  ICU sees valid UTF-8 and reports it as such.
+
+The scan skips ASCII runs with the vectorized scan in utf8scan.c and stops
+at a lead character followed by as many continuation characters as the lead
+byte calls for.  Their bytes count as a double encoded sequence only if
+they form a well-formed UTF-8 sequence again.  Anything else is copied as
+it is, so correctly encoded text mixed into the same value is left alone.
+Each pass undoes one layer of double encoding, and every restored sequence
+is shorter than the characters it replaces.
+*/
+
+// windows-1252 table from sbcs_tables.c, looked up on first use
+static const SbcsCharset* windows_1252 = NULL;
+
+static int mojibake_byte(const unsigned char* s, size_t n);
+static size_t mojibake_sequence(const unsigned char* s, size_t len, unsigned char* bytes, size_t* nbytes);
+
+// byte that windows-1252 or latin1 decodes to the n byte UTF-8 character at
+// s, -1 if it is not one of 0x80 to 0xFF
+static int
+mojibake_byte(const unsigned char* s, size_t n)
+{
+    int c;
+
+    // U+0080 to U+00FF: latin1, and windows-1252 from 0xA0 on
+    if (2 == n && (0xC2 == s[0] || 0xC3 == s[0]))
+        return ((s[0] & 0x03) << 6) | (s[1] & 0x3F);
+
+    if (NULL == windows_1252)
+        windows_1252 = sbcs_lookup("windows-1252");
+
+    if (NULL == windows_1252)
+        return -1;
+
+    // the windows-1252 punctuation and letters at 0x80 to 0x9F
+    for (c = 0x80; c < 0xA0; c++)
+    {
+        const SbcsChar* ch = &windows_1252->map[c];
+
+        if (ch->len == n && 0 == memcmp(ch->bytes, s, n))
+            return c;
+    }
+
+    return -1;
+}
+
+// bytes of the double encoded sequence at the start of s, 0 if there is
+// none; the original sequence is stored in bytes and its length in nbytes
+static size_t
+mojibake_sequence(const unsigned char* s, size_t len, unsigned char* bytes, size_t* nbytes)
+{
+    size_t  pos = 2;
+    size_t  need;
+    size_t  n;
+    size_t  i;
+    int     b;
+
+    // U+00C2 to U+00F4 are the lead bytes of UTF-8
+    if (len < 2 || 0xC3 != s[0] || s[1] < 0x82 || s[1] > 0xB4)
+        return 0;
+
+    bytes[0] = 0xC0 | (s[1] & 0x3F);
+    need = (bytes[0] >= 0xF0) ? 4 : (bytes[0] >= 0xE0) ? 3 : 2;
+
+    for (i = 1; i < need; i++)
+    {
+        n = utf8_sequence_len((const char*) s + pos, len - pos);
+        if (0 == n)
+            return 0;
+
+        b = mojibake_byte(s + pos, n);
+        if (b < 0x80 || b > 0xBF)
+            return 0;
+
+        bytes[i] = (unsigned char) b;
+        pos += n;
+    }
+
+    // no overlongs, surrogates or code points above U+10FFFF
+    if (utf8_sequence_len((const char*) bytes, need) != need)
+        return 0;
+
+    *nbytes = need;
+    return pos;
+}
+
+bool
+mojibake_find(const char* buffer, size_t len)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    unsigned char bytes[4];
+    size_t nbytes;
+    size_t i = 0;
+
+    while (i < len)
+    {
+        size_t n;
+
+        i += ascii_prefix_len(buffer + i, len - i);
+        if (i >= len)
+            break;
+
+        if (0 != mojibake_sequence(s + i, len - i, bytes, &nbytes))
+            return true;
+
+        n = utf8_sequence_len(buffer + i, len - i);
+        i += (0 != n) ? n : 1;
+    }
+
+    return false;
+}
+
+size_t
+mojibake_repair(const char* buffer, size_t len, char* out, size_t* repaired)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    unsigned char bytes[4];
+    size_t nbytes;
+    size_t i = 0;
+    size_t o = 0;
+
+    *repaired = 0;
+
+    while (i < len)
+    {
+        size_t run = ascii_prefix_len(buffer + i, len - i);
+        size_t n;
+
+        memcpy(out + o, buffer + i, run);
+        i += run;
+        o += run;
+
+        if (i >= len)
+            break;
+
+        n = mojibake_sequence(s + i, len - i, bytes, &nbytes);
+        if (0 != n)
+        {
+            memcpy(out + o, bytes, nbytes);
+            o += nbytes;
+            i += n;
+            (*repaired)++;
+            continue;
+        }
+
+        n = utf8_sequence_len(buffer + i, len - i);
+        if (0 == n)
+            n = 1;
+
+        memcpy(out + o, buffer + i, n);
+        i += n;
+        o += n;
+    }
+
+    return o;
+}
@@ -0,0 +1,16 @@
+#ifndef _MOJIBAKE
+#define _MOJIBAKE
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// true if UTF-8 buffer holds a multibyte UTF-8 sequence that was decoded as
+// windows-1252 or latin1 and encoded to UTF-8 again, like "Ã©" for "é"
+bool mojibake_find(const char* buffer, size_t len);
+
+// undoes one layer of such double encoding, writing to out, which must have
+// room for len bytes; returns the bytes written and sets repaired to the
+// number of sequences restored
+size_t mojibake_repair(const char* buffer, size_t len, char* out, size_t* repaired);
+
+#endif
@@ -0,0 +1,162 @@
+#include "nativedet.h"
+#include "utf8scan.h"
+
+/*
+Native detection of the UTF-8 / windows-1252 / ISO-8859-1 triad.
+
+Western text that is not valid UTF-8 is nearly always one of these three,
+and the bytes alone usually settle which: well-formed UTF-8 sequences make
+up almost all of the high bytes of (slightly damaged) UTF-8, windows-1252
+puts printable characters in the C1 range 0x80-0x9F that ISO-8859-1 leaves
+to control codes, and in either of them the high bytes are a minority of
+accented letters from 0xC0-0xFF.
+
+One pass builds a histogram of byte classes.  Anything that does not fit
+that picture - too many high bytes for a Latin script, bytes windows-1252
+leaves undefined, symbols from 0xA0-0xBF in the middle of words, which is
+where ISO-8859-2 and windows-1250 keep letters, or an unusual share of the
+Icelandic letters ISO-8859-9 reuses for Turkish - is left to ICU.
+*/
+
+typedef struct
+{
+    size_t  total;          // bytes examined
+    size_t  high;           // bytes >= 0x80
+    size_t  nul;
+    size_t  utf8_seqs;      // well-formed multibyte UTF-8 sequences
+    size_t  utf8_bytes;     // bytes in those sequences
+    size_t  c1;             // 0x80-0x9F outside UTF-8 sequences
+    size_t  c1_undefined;   // of those, undefined in windows-1252
+    size_t  symbol_in_word; // 0xA0-0xBF between ASCII letters
+    size_t  reused;         // 0xD0 0xDD 0xDE 0xF0 0xFD 0xFE
+} ByteHistogram;
+
+#define IS_ASCII_ALPHA(c)   ((((c) | 0x20) >= 'a') && (((c) | 0x20) <= 'z'))
+
+// share of high bytes above which text is not in a Latin script, percent
+#define MAX_LATIN_HIGH_PERCENT  30
+
+static void
+build_histogram(const char* buffer, size_t len, ByteHistogram* h)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i = 0;
+
+    h->total = len;
+    h->high = h->nul = 0;
+    h->utf8_seqs = h->utf8_bytes = 0;
+    h->c1 = h->c1_undefined = 0;
+    h->symbol_in_word = h->reused = 0;
+
+    while (i < len)
+    {
+        unsigned char c;
+        size_t n;
+
+        i += ascii_prefix_len(buffer + i, len - i);
+        if (i >= len)
+            break;
+
+        c = s[i];
+
+        // the ASCII scan only stops below 0x80 on NUL
+        if (c < 0x80)
+        {
+            h->nul++;
+            i++;
+            continue;
+        }
+
+        n = utf8_sequence_len(buffer + i, len - i);
+        h->high += (n > 0) ? n : 1;
+
+        if (n > 0)
+        {
+            h->utf8_seqs++;
+            h->utf8_bytes += n;
+            i += n;
+            continue;
+        }
+
+        if (c <= 0x9F)
+        {
+            h->c1++;
+            if (c == 0x81 || c == 0x8D || c == 0x8F || c == 0x90 || c == 0x9D)
+                h->c1_undefined++;
+        }
+        else if (c <= 0xBF)
+        {
+            if (i > 0 && i + 1 < len && IS_ASCII_ALPHA(s[i - 1]) && IS_ASCII_ALPHA(s[i + 1]))
+                h->symbol_in_word++;
+        }
+        else if (c == 0xD0 || c == 0xDD || c == 0xDE || c == 0xF0 || c == 0xFD || c == 0xFE)
+            h->reused++;
+
+        i++;
+    }
+}
+
+bool
+native_detect(const char* buffer, size_t len, NativeGuess* guess)
+{
+    ByteHistogram h;
+    size_t latin;
+
+    build_histogram(buffer, len, &h);
+
+    // high bytes that are not part of a UTF-8 sequence
+    latin = h.high - h.utf8_bytes;
+
+    // nothing to go on; ICU would report ISO-8859-1 as well
+    if (0 == h.high)
+    {
+        guess->charset = NATIVE_ISO_8859_1;
+        guess->confidence = 10;
+        return 0 == h.nul;
+    }
+
+    // UTF-8 with a few stray bytes, e.g. cut off or concatenated
+    if (h.utf8_bytes >= 4 * latin)
+    {
+        guess->charset = NATIVE_UTF8;
+        guess->confidence = (int) (100 * h.utf8_bytes / h.high) - 10;
+        return h.utf8_seqs > 1 && 0 == h.nul;
+    }
+
+    guess->charset = (h.c1 > h.c1_undefined) ? NATIVE_WINDOWS_1252 : NATIVE_ISO_8859_1;
+
+    // more evidence, more confidence
+    guess->confidence = 50 + (int) ((latin < 30) ? latin : 30);
+
+    // a mix of UTF-8 and single byte text
+    if (h.utf8_seqs > 0 && h.utf8_bytes * 4 >= latin)
+        return false;
+
+    // some other script or charset
+    if (h.nul > 0 ||
+        h.c1_undefined > 0 ||
+        100 * h.high > MAX_LATIN_HIGH_PERCENT * h.total ||
+        20 * h.symbol_in_word > latin ||
+        10 * h.reused > latin)
+    {
+        guess->confidence /= 2;
+        return false;
+    }
+
+    return true;
+}
+
+const char*
+native_charset_name(NativeCharset charset)
+{
+    switch (charset)
+    {
+        case NATIVE_UTF8:
+            return "UTF-8";
+        case NATIVE_WINDOWS_1252:
+            return "windows-1252";
+        case NATIVE_ISO_8859_1:
+        default:
+            return "ISO-8859-1";
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef _NATIVEDET
+#define _NATIVEDET
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// charsets the native detector can tell apart
+typedef enum
+{
+    NATIVE_UTF8,
+    NATIVE_WINDOWS_1252,
+    NATIVE_ISO_8859_1
+} NativeCharset;
+
+typedef struct
+{
+    NativeCharset   charset;
+    int             confidence;     // 0-100, same scale as ICU
+} NativeGuess;
+
+// guesses whether buffer is UTF-8, windows-1252 or ISO-8859-1 in one pass;
+// guess is always set, and the return value is false if the bytes look like
+// something else or do not settle it, in which case ICU should decide
+bool native_detect(const char* buffer, size_t len, NativeGuess* guess);
+
+// ICU name of charset
+const char* native_charset_name(NativeCharset charset);
+
+#endif
@@ -41,8 +41,39 @@ MODIFICATIONS.
 #include "catalog/namespace.h"
 #include "catalog/pg_type.h"
 #include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/memutils.h"
+#include "lib/stringinfo.h"
+#include "access/detoast.h"
 #include "access/heapam.h"
+#include "utils/array.h"
+#include "utils/lsyscache.h"
+#include "utils/typcache.h"
+#include "utils/jsonb.h"
+#include "libpq/pqformat.h"
+#include "commands/trigger.h"
+#include "utils/datum.h"
+#include "utils/rel.h"
+#include "utils/relcache.h"
+#include "access/sysattr.h"
+#include "executor/spi.h"
+#include "nodes/bitmapset.h"
+#include "access/htup_details.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "catalog/pg_class.h"
+#include "miscadmin.h"
+#include "pgstat.h"
+#include "postmaster/bgworker.h"
+#include "storage/bufmgr.h"
+#include "storage/latch.h"
+#include "storage/lmgr.h"
+#include "tcop/tcopprot.h"
+#include "utils/snapmgr.h"
+#include "utils/timestamp.h"
 #include "funcapi.h"
+#include "utils/tuplestore.h"
+#include "common/hashfn.h"
 
 #include "unicode/utypes.h"
 #include "unicode/ucsdet.h"
@@ -50,605 +81,4956 @@ MODIFICATIONS.
 #include "unicode/ucnv_err.h"
 #include "unicode/ustring.h"
 #include "unicode/uloc.h"
+#include "unicode/unorm2.h"
 //#include "unicode/unistr.h"
 
 #include "flagcb.h"
+#include "utf8scan.h"
+#include "sbcs.h"
+#include "nativedet.h"
+#include "resultcache.h"
+#include "coldecision.h"
+#include "mojibake.h"
 
 PG_MODULE_MAGIC;
 
+// message_level_is_interesting() is new in 14; before that the guards are
+// dropped and ereport() alone decides, without evaluating its arguments
+#if PG_VERSION_NUM < 140000
+#define message_level_is_interesting(elevel) true
+#endif
+
+/*
+ * ICU detectors and converters are expensive to open and cheap to reuse, so
+ * each function call site keeps them in fn_extra for the life of the query.
+ * The state is allocated in fn_mcxt and a reset callback on that context
+ * closes the ICU objects, so nothing is leaked when a query errors out.
+ */
+
+// number of converters kept open per call site
+#define CONVERTER_POOL_SIZE 8
+
+// what a converter does with bytes it cannot map
+typedef enum
+{
+    CONVERT_SUBSTITUTE,     // ICU's substitution characters
+    CONVERT_FORCE,          // skip them and flag that it did
+    CONVERT_STRICT          // stop converting
+} ConvertMode;
+
+// ICU converter name for a PostgreSQL encoding, NULL if ICU has none
+typedef struct EncodingName
+{
+    const char          *pg_name;
+    const char          *icu_name;
+} EncodingName;
+
+static const EncodingName pg_icu_encodings[] =
+{
+    {"SQL_ASCII",       "US-ASCII"},
+    {"EUC_JP",          "EUC-JP"},
+    {"EUC_CN",          "EUC-CN"},
+    {"EUC_KR",          "EUC-KR"},
+    {"EUC_TW",          "EUC-TW"},
+    {"EUC_JIS_2004",    NULL},
+    {"UTF8",            "UTF-8"},
+    {"MULE_INTERNAL",   NULL},
+    {"LATIN1",          "ISO-8859-1"},
+    {"LATIN2",          "ISO-8859-2"},
+    {"LATIN3",          "ISO-8859-3"},
+    {"LATIN4",          "ISO-8859-4"},
+    {"LATIN5",          "ISO-8859-9"},
+    {"LATIN6",          "ISO-8859-10"},
+    {"LATIN7",          "ISO-8859-13"},
+    {"LATIN8",          "ISO-8859-14"},
+    {"LATIN9",          "ISO-8859-15"},
+    {"LATIN10",         NULL},
+    {"WIN1256",         "windows-1256"},
+    {"WIN1258",         "windows-1258"},
+    {"WIN866",          "IBM866"},
+    {"WIN874",          "windows-874"},
+    {"KOI8R",           "KOI8-R"},
+    {"WIN1251",         "windows-1251"},
+    {"WIN1252",         "windows-1252"},
+    {"ISO_8859_5",      "ISO-8859-5"},
+    {"ISO_8859_6",      "ISO-8859-6"},
+    {"ISO_8859_7",      "ISO-8859-7"},
+    {"ISO_8859_8",      "ISO-8859-8"},
+    {"WIN1250",         "windows-1250"},
+    {"WIN1253",         "windows-1253"},
+    {"WIN1254",         "windows-1254"},
+    {"WIN1255",         "windows-1255"},
+    {"WIN1257",         "windows-1257"},
+    {"KOI8U",           "KOI8-U"},
+    {"SJIS",            "Shift_JIS"},
+    {"BIG5",            "Big5"},
+    {"GBK",             "GBK"},
+    {"UHC",             "windows-949"},
+    {"GB18030",         "GB18030"},
+    {"JOHAB",           NULL},
+    {"SHIFT_JIS_2004",  NULL},
+    {NULL,              NULL}
+};
+
+typedef struct ConverterEntry
+{
+    char                name[UCNV_MAX_CONVERTER_NAME_LENGTH];
+    ConvertMode         mode;
+    UConverter          *conv;
+    ToUFLAGContext      *toU_context;   // owned by conv in CONVERT_FORCE mode
+    FromUFLAGContext    *fromU_context;
+    uint64              last_used;
+} ConverterEntry;
+
+typedef struct ChardetectState
+{
+    UCharsetDetector        *csd;
+    ConverterEntry          converters[CONVERTER_POOL_SIZE];
+    int                     nconverters;
+    uint64                  use_count;
+    MemoryContextCallback   cleanup;
+
+    // work memory of the value being processed, reset once its result is
+    // built, so memory use follows the largest value rather than the count
+    MemoryContext           scratch;
+
+    // per-call allowed charsets and declared encoding, NULL for the settings
+    const char              *allowed_override;
+    const char              *declared_override;
+
+    // columns converted by pg_chardetect_convert_trigger, resolved once
+    Oid                     trigger_oid;
+    int                     trigger_ncolumns;
+    int                     *trigger_columns;   // attribute numbers
+
+    // text columns of the row type convert_record_to_utf8 last saw
+    Oid                     record_type;
+    int32                   record_typmod;
+    int                     record_ncolumns;
+    int                     *record_columns;    // attribute numbers
+} ChardetectState;
+
+// result of converting one value
+typedef struct ConvertResult
+{
+    text        *text_out;      // converted value, NULL to keep the input
+    bool        converted;
+    bool        dropped_bytes;
+} ConvertResult;
+
+// char_set_detect_agg() transition state: non-ASCII values pooled for
+// a single detection
+typedef struct DetectAggState
+{
+    StringInfoData  pool;
+    int32           max_bytes;
+    int64           rows;
+} DetectAggState;
+
+// changed rows pg_chardetect_convert_batch_trigger() and the
+// pg_chardetect_convert_table() workers write back with one UPDATE
+typedef struct ConvertBatch
+{
+    int                 nkeys;
+    int                 ncolumns;
+    bool                force;
+    ColumnDecision      *decisions;         // per column, COLUMN_DETECT by default
+    ArrayBuildState     **keys;
+    ArrayBuildState     **values;
+    int                 nrows;
+    char                *select_list;       // keys, then columns
+    char                *update;            // UPDATE statement
+    Oid                 *argtypes;
+    MemoryContext       context;            // for the arrays
+} ConvertBatch;
+
+// what a pg_chardetect_convert_table() worker works on, passed in bgw_extra
+typedef struct ConvertWorkerArgs
+{
+    Oid             dboid;
+    Oid             roleoid;
+    Oid             relid;
+    Oid             progress_relid;     // pg_chardetect_convert_progress
+    TransactionId   launcher_xid;       // inserted the progress rows, invalid on resume
+    int64           range_start;        // identifies the worker's range
+    int32           batch_rows;
+    int32           sleep_ms;
+    int64           max_wal_bytes_per_sec;
+    bool            force;
+} ConvertWorkerArgs;
+
+// charset_profile() transition state: one entry per encoding seen
+typedef struct ProfileEntry
+{
+    char        encoding[NAMEDATALEN];
+    bool        isnull;             // detection failed
+    int64       count;
+    int64       ascii_count;
+    int64       confidence_sum;
+    int64       bytes;
+} ProfileEntry;
+
+typedef struct ProfileState
+{
+    int             nentries;
+    int             maxentries;
+    ProfileEntry    *entries;
+} ProfileState;
+
+// GUC variables
+
+// bytes of a value examined by detection, 0 for the whole value
+static int  max_detect_bytes = 0;
+// number of evenly spaced slices those bytes are taken from
+static int  detect_slices = 1;
+
+// values larger than this are converted from slices, 0 to never stream
+static int  stream_threshold = 16 * 1024 * 1024;
+
+// how charsets that are not ASCII or valid UTF8 are detected
+typedef enum
+{
+    DETECTOR_HYBRID,    // native detector, ICU when it is not sure
+    DETECTOR_NATIVE,    // native detector only
+    DETECTOR_ICU        // ICU only
+} DetectorMode;
+
+static const struct config_enum_entry detector_options[] =
+{
+    {"hybrid", DETECTOR_HYBRID, false},
+    {"native", DETECTOR_NATIVE, false},
+    {"icu", DETECTOR_ICU, false},
+    {NULL, 0, false}
+};
+
+static int  detector_mode = DETECTOR_ICU;
+
+// comma separated charsets ICU may report, empty for all it knows
+static char *allowed_charsets = NULL;
+// charset the values are declared to be in, empty for none
+static char *declared_encoding = NULL;
+// look up the language of ICU matches
+static bool detect_language = true;
+
+// slices are never shorter than this
+#define MIN_DETECT_SLICE_BYTES 1024
+
+// pool size of char_set_detect_agg and of the jsonb and text[] converters
+// when neither an argument nor pg_chardetect.max_detect_bytes sets one
+#define DEFAULT_DETECT_AGG_BYTES (64 * 1024)
+
 // Forward declarations
 
+void        _PG_init(void);
+
 Datum       char_set_detect(PG_FUNCTION_ARGS);
+Datum       char_set_detect_hinted(PG_FUNCTION_ARGS);
+Datum       char_set_detect_all(PG_FUNCTION_ARGS);
 Datum       convert_to_UTF8(PG_FUNCTION_ARGS);
-
-UErrorCode  detect_ICU(const text* buffer, text** encoding, text** lang, int32_t* confidence);
+Datum       convert_to_UTF8_from(PG_FUNCTION_ARGS);
+Datum       convert_record_to_utf8(PG_FUNCTION_ARGS);
+Datum       convert_jsonb_to_UTF8(PG_FUNCTION_ARGS);
+Datum       convert_to_UTF8_normalized(PG_FUNCTION_ARGS);
+Datum       repair_mojibake(PG_FUNCTION_ARGS);
+Datum       convert_mixed_to_UTF8(PG_FUNCTION_ARGS);
+Datum       char_set_detect_array(PG_FUNCTION_ARGS);
+Datum       convert_to_UTF8_array(PG_FUNCTION_ARGS);
+Datum       charset_profile_transfn(PG_FUNCTION_ARGS);
+Datum       charset_profile_combinefn(PG_FUNCTION_ARGS);
+Datum       charset_profile_serialfn(PG_FUNCTION_ARGS);
+Datum       charset_profile_deserialfn(PG_FUNCTION_ARGS);
+Datum       charset_profile_finalfn(PG_FUNCTION_ARGS);
+Datum       char_set_detect_agg_transfn(PG_FUNCTION_ARGS);
+Datum       char_set_detect_agg_combinefn(PG_FUNCTION_ARGS);
+Datum       char_set_detect_agg_serialfn(PG_FUNCTION_ARGS);
+Datum       char_set_detect_agg_deserialfn(PG_FUNCTION_ARGS);
+Datum       char_set_detect_agg_finalfn(PG_FUNCTION_ARGS);
+Datum       pg_chardetect_convert_trigger(PG_FUNCTION_ARGS);
+Datum       pg_chardetect_convert_batch_trigger(PG_FUNCTION_ARGS);
+Datum       pg_chardetect_convert_table(PG_FUNCTION_ARGS);
+PGDLLEXPORT void pg_chardetect_convert_worker(Datum main_arg);
+
+ChardetectState* get_chardetect_state(FunctionCallInfo fcinfo);
+ChardetectState* create_chardetect_state(MemoryContext context);
+void        chardetect_state_cleanup(void* arg);
+UCharsetDetector* get_detector(ChardetectState* state, UErrorCode* status);
+void        detect_options(ChardetectState* state, const char** allowed, const char** declared);
+const char* next_charset_name(const char* list, char* name, size_t size);
+bool        charset_in_list(const char* list, const char* name);
+bool        check_charset_list(const char* list, char* bad, size_t size);
+bool        check_allowed_charsets(char** newval, void** extra, GucSource source);
+int32       detect_cache_tag(ChardetectState* state);
+ConverterEntry* get_converter(ChardetectState* state, const char* name, ConvertMode mode, UErrorCode* status);
+const char* icu_encoding_name(const char* name);
+void        get_detect_sample(Datum datum, int32 max_bytes, const char** sample, int32* sample_len);
+Datum       detect_value_tuple(FunctionCallInfo fcinfo, ChardetectState* state, Datum value, int32 max_bytes);
+void        add_candidate_row(Tuplestorestate* tupstore, TupleDesc tupdesc, const char* encoding, const char* lang, int32 confidence, bool mojibake);
+void        detect_value(ChardetectState* state, Datum value, int32 max_bytes, text** encoding, text** lang, int32_t* confidence, bool* mojibake);
+bool        encoding_is_utf8(const text* encoding);
+text*       copy_text(const text* t);
+ArrayType*  construct_result_array(ArrayType* input, Datum* elems, bool* nulls, Oid element_type);
+
+ProfileState* profile_state_create(MemoryContext aggcontext);
+ProfileEntry* profile_state_entry(ProfileState* pstate, const char* encoding);
+int         profile_entry_cmp(const void* a, const void* b);
+DetectAggState* detect_agg_state_create(MemoryContext aggcontext, int32 max_bytes);
+void        detect_agg_append(DetectAggState* astate, const char* data, int32 len);
+void        resolve_trigger_columns(ChardetectState* state, MemoryContext context, Trigger* trigger, Relation relation);
+void        resolve_record_columns(ChardetectState* state, MemoryContext context, TupleDesc rowdesc, Oid rectype, int32 rectypmod);
+int         resolve_columns(const char* caller, Relation relation, const char** names, int nnames, int* columns);
+bool        is_text_type(Oid type);
+void        convert_batch_init(ConvertBatch* batch, const char* target, int nkeys, const char** key_names, const Oid* key_types, int ncolumns, const char** column_names, bool force);
+void        convert_batch_row(ConvertBatch* batch, ChardetectState* state, HeapTuple tuple, TupleDesc tupdesc);
+void        convert_batch_apply(ConvertBatch* batch);
+char*       qualified_relation_name(Oid relid);
+bool        convert_worker_batch(ChardetectState* state, const ConvertWorkerArgs* args, MemoryContext scratch);
+void        convert_worker_throttle(const ConvertWorkerArgs* args, XLogRecPtr wal_start, TimestampTz batch_start);
+
+UErrorCode  detect_charset(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence);
+UErrorCode  detect_encoding(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence);
+UErrorCode  detect_ICU(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence);
 
 // UErrorCode  force_conversion(const char* cbuffer, const text* encoding, char** converted_buf, int32_t* converted_len);
 char* strip_bytes(const char* buffer, int32_t buffer_len, const char* bad_bytes, int8_t bad_bytes_len);
 
-UErrorCode  convert_to_unicode(const text* buffer, const text* encoding, UChar** uBuf, int32_t *uBuf_len, bool force, bool* dropped_bytes);
-UErrorCode  convert_to_utf8(const UChar* buffer, int32_t buffer_len, char** converted_buf, int32_t *converted_buf_len, bool force, bool* dropped_bytes);
-
-#define STRING_IS_NULL_TERMINATED -1
+UErrorCode  transcode_to_utf8(ChardetectState* state, const char* buffer, int32_t buffer_len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes);
+UErrorCode  transcode_datum_to_utf8(ChardetectState* state, Datum datum, int32 datum_len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes);
+UErrorCode  transcode_chunks(ChardetectState* state, const char* buffer, Datum datum, int32 len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes);
+UErrorCode  transcode_sbcs(const SbcsCharset* sbcs, const char* buffer, Datum datum, int32 len, ConvertMode mode, text** text_out, bool* dropped_bytes);
+UErrorCode  transcode_mixed(const SbcsCharset* sbcs, const char* buffer, int32 len, bool force, text** text_out, bool* dropped_bytes);
+const SbcsCharset* mixed_fallback_charset(ChardetectState* state, Datum value, const char* fallback);
+bool        datum_is_streamable(Datum datum);
+ByteClass   classify_datum(Datum datum, int32 datum_len);
+
+void        convert_datum(ChardetectState* state, Datum value, bool force, ConvertResult* result);
+void        convert_column(ChardetectState* state, Datum value, const ColumnDecision* decision, bool force, ConvertResult* result);
+void        convert_buffer(ChardetectState* state, const char* buffer, int32 len, bool force, ConvertResult* result);
+void        convert_leaves(ChardetectState* state, int nleaves, const char** leaves, const int32* lens, bool force, ConvertResult* results);
+Jsonb*      replace_jsonb_strings(Jsonb* jb, const ConvertResult* results);
+const UNormalizer2* get_normalizer(const char* form, UChar32* quick_below);
+text*       normalize_utf8(const UNormalizer2* normalizer, UChar32 quick_below, const char* buffer, int32 len);
+Datum       convert_result_tuple(FunctionCallInfo fcinfo, Datum value, ConvertResult* result);
+Datum       check_bytea_result(Datum value, bool force, ConvertResult* result);
+void        convert_detected(ChardetectState* state, const char* buffer, Datum datum, int32 len, UErrorCode status, text* encoding, bool force, ConvertResult* result);
+
+// UChars in the pivot buffer between the source and UTF-8 converters
+#define PIVOT_BUFFER_SIZE 1024
+
+// bytes of input read at a time when streaming a large value
+#define STREAM_CHUNK_BYTES (1024 * 1024)
 
 /*
 Functions:
 
 exposed:
 
-    char_set_detect(text):
-        - input is text to convert
+    char_set_detect(text), char_set_detect(bytea):
+    char_set_detect(text, integer), char_set_detect(bytea, integer):
+        - input is text to convert,
+          optional maximum number of bytes to examine
+          (default pg_chardetect.max_detect_bytes)
+        - returns encoding, language, confidence (0-100), and whether
+          UTF-8 text looks double encoded (mojibake)
+
+    char_set_detect(text, text[], text):
+        - input is text to check, the charsets detection may report
+          (all if empty) and the charset the text is declared to be in
+          (none if empty), overriding pg_chardetect.allowed_charsets and
+          pg_chardetect.declared_encoding
         - returns encoding, language, confidence (0-100)
 
-    convert_to_UTF8(text, boolean):
+    char_set_detect_all(text, integer, integer):
+        - input is text to check, the maximum number of candidates and
+          the minimum confidence of a candidate
+        - returns ICU's matches as encoding, language, confidence,
+          mojibake rows, best first, from a single detection pass
+
+    convert_mixed_to_UTF8(text, boolean, text):
+        - input is text to convert, true to force conversion and the
+          single byte charset of the bytes that are not UTF8, detected
+          once for the whole value if empty
+        - returns the text with its valid UTF8 kept and every other span
+          converted from that charset, converted and dropped_bytes flags
+
+    repair_mojibake(text):
+        - input is UTF8 text that may have been decoded as windows-1252
+          or latin1 and encoded again, once or more
+        - returns the text with every double encoded sequence restored;
+          see mojibake.c
+
+    convert_record_to_utf8(anyelement, boolean):
+        - input is a row and true to force conversion
+        - returns the row with its text and varchar columns converted
+          to UTF8, and the names of the columns that changed
+
+    convert_to_UTF8(text, text):
+        - input is text to convert and its encoding, a PostgreSQL or ICU
+          name
+        - returns the text converted to UTF8 and true, or the input and
+          false if any byte of it cannot be converted
+
+    convert_to_UTF8(text, boolean), convert_to_UTF8(bytea, boolean):
         - input is text to convert,
           true to force conversion by dropping bytes,
           false to not force conversion
-        - returns converted text if successful, input text if not,
-          converted boolean flag, dropped_bytes boolean flag
+        - returns converted text if successful, input text if not
+          (NULL for bytea input), converted boolean flag, dropped_bytes
+          boolean flag
+
+    char_set_detect(text[]):
+        - input is an array of text to check
+        - returns encoding, language and confidence arrays parallel to it
+
+    convert_to_UTF8(text, boolean, text):
+        - as convert_to_UTF8(text, boolean), then normalizes the result
+          to the Unicode normalization form named by the last argument,
+          NFC, NFD, NFKC or NFKD
+
+    convert_to_UTF8(text, regclass, name, boolean):
+        - as convert_to_UTF8(text, boolean), for a value of the named
+          column, following its decision in pg_chardetect_column_encoding:
+          converted from the known encoding without detection, or kept
+
+    convert_to_UTF8(text[], boolean):
+        - input is an array of text to convert, force flag as above
+        - returns text_out, converted and dropped_bytes arrays parallel to it
+
+    convert_to_UTF8(text[], boolean, boolean):
+        - convert_to_UTF8(text[], boolean) with the elements of a single
+          value, pooled for detection if the last argument is true
+
+    convert_to_UTF8(jsonb, boolean):
+        - input is a document to convert and true to force conversion
+        - returns the document with its keys and strings converted to
+          UTF8, whether all were converted and whether bytes were dropped
+
+    charset_profile(text) aggregate:
+        - input is the text column to profile
+        - returns a charset_profile row per encoding: encoding, count,
+          ascii_count, mean_confidence, bytes
+        - parallel safe, with combine and (de)serialization functions
+
+    char_set_detect_agg(text), char_set_detect_agg(text, integer) aggregate:
+        - input is the text column to detect,
+          optional maximum number of bytes to pool
+          (default pg_chardetect.max_detect_bytes, or 64kB if that is 0)
+        - returns encoding, language, confidence detected from the
+          pooled non-ASCII values
+        - parallel safe, with combine and (de)serialization functions
+
+    pg_chardetect_convert_trigger(column [, ...]) trigger:
+        - BEFORE INSERT OR UPDATE row trigger
+        - force converts the named text columns (all text and varchar
+          columns if none are named) to UTF8 in place, skipping values
+          that are already valid and columns an UPDATE did not change
+
+    pg_chardetect_convert_batch_trigger(column [, ...]) trigger:
+        - AFTER INSERT OR UPDATE statement trigger with a NEW TABLE
+          transition table
+        - converts the named text columns of the new rows as above and
+          writes back the changed rows in batches, matched on the
+          primary key or replica identity
+
+    pg_chardetect_column_encoding_invalidate() trigger:
+        - keeps the per-backend cache of pg_chardetect_column_encoding
+          current; see coldecision.c
+
+    pg_chardetect_convert_table(regclass, text[], integer, integer, boolean, integer, bigint):
+        - input is the table to convert, the text columns to convert
+          (all text and varchar columns if empty), number of workers,
+          rows per batch, force flag, sleep between batches in ms and
+          maximum WAL bytes per second (0 for no limit)
+        - starts background workers that convert block ranges of the
+          table in committed batches, recording their progress in
+          pg_chardetect_convert_progress, or resumes an interrupted run
+        - returns the number of workers started
+
+    text and bytea share a varlena layout, so the bytea overloads use the
+    same C functions; input is read with explicit lengths, never as a
+    NUL-terminated C string.
 
 internal:
 
+    _PG_init()
+    get_chardetect_state()
+    create_chardetect_state()
+    get_detector()
+    get_converter()
+    icu_encoding_name()
+    get_detect_sample()
+    detect_value()
+    detect_charset()
+    detect_encoding()
     detect_ICU()
+    transcode_to_utf8()
+    transcode_datum_to_utf8()
+    transcode_sbcs()
+    transcode_mixed()
+    mixed_fallback_charset()
+    convert_datum()
+    convert_column()
+    convert_buffer()
+    convert_leaves()
+    check_bytea_result()
+    normalize_utf8()
 
 */
 
-UErrorCode
-detect_ICU(const text* buffer, text** encoding, text** lang, int32_t* confidence)
+void
+_PG_init(void)
 {
-    const char* cbuffer = text_to_cstring(buffer);
-    //int cbuffer_len = strlen(cbuffer);
-
-    UCharsetDetector* csd;
-    const UCharsetMatch* csm;
-    UErrorCode status = U_ZERO_ERROR;
+    DefineCustomIntVariable("pg_chardetect.max_detect_bytes",
+                            "Maximum number of bytes of a value examined by charset detection.",
+                            "Longer values are detected from a sample of this size, "
+                            "fetched without detoasting the whole value.  0 examines the whole value.",
+                            &max_detect_bytes,
+                            0,
+                            0,
+                            MaxAllocSize,
+                            PGC_USERSET,
+                            GUC_UNIT_BYTE,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomIntVariable("pg_chardetect.detect_slices",
+                            "Number of evenly spaced slices the detection sample is taken from.",
+                            "1 examines only the start of the value.",
+                            &detect_slices,
+                            1,
+                            1,
+                            64,
+                            PGC_USERSET,
+                            0,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomIntVariable("pg_chardetect.stream_threshold",
+                            "Size above which convert_to_UTF8 streams a value in chunks.",
+                            "Larger values stored out of line and uncompressed are read and "
+                            "converted in chunks instead of being detoasted whole.  0 never streams.",
+                            &stream_threshold,
+                            16 * 1024 * 1024,
+                            0,
+                            MaxAllocSize,
+                            PGC_USERSET,
+                            GUC_UNIT_BYTE,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomEnumVariable("pg_chardetect.detector",
+                             "Detector used for input that is not ASCII or valid UTF-8.",
+                             "native tells UTF-8, windows-1252 and ISO-8859-1 apart from byte "
+                             "statistics, icu uses ICU's charset detector, hybrid uses ICU only "
+                             "when the native detector is not sure.",
+                             &detector_mode,
+                             DETECTOR_ICU,
+                             detector_options,
+                             PGC_USERSET,
+                             0,
+                             NULL,
+                             NULL,
+                             NULL);
+
+    DefineCustomIntVariable("pg_chardetect.cache_entries",
+                            "Maximum number of results kept in the per-backend result cache.",
+                            "Repeated values are detected and converted once.  0 disables the cache.",
+                            &cache_entries,
+                            0,
+                            0,
+                            INT_MAX / 2,
+                            PGC_USERSET,
+                            0,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomIntVariable("pg_chardetect.cache_size",
+                            "Maximum memory used by the per-backend result cache.",
+                            NULL,
+                            &cache_size,
+                            8 * 1024 * 1024,
+                            0,
+                            MaxAllocSize,
+                            PGC_USERSET,
+                            GUC_UNIT_BYTE,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomIntVariable("pg_chardetect.cache_max_value_bytes",
+                            "Size of the largest value whose results are cached.",
+                            NULL,
+                            &cache_max_value_bytes,
+                            4096,
+                            0,
+                            MaxAllocSize,
+                            PGC_USERSET,
+                            GUC_UNIT_BYTE,
+                            NULL,
+                            NULL,
+                            NULL);
+
+    DefineCustomStringVariable("pg_chardetect.allowed_charsets",
+                               "Comma separated list of the charsets ICU detection may report.",
+                               "The best ICU match among them wins, which keeps detection from reporting "
+                               "charsets the data cannot be in.  Empty allows all of them.",
+                               &allowed_charsets,
+                               "",
+                               PGC_USERSET,
+                               GUC_LIST_INPUT,
+                               check_allowed_charsets,
+                               NULL,
+                               NULL);
+
+    DefineCustomStringVariable("pg_chardetect.declared_encoding",
+                               "Charset the values are declared to be in.",
+                               "Detection reports it whenever the bytes are plausible in it.  Empty for none.",
+                               &declared_encoding,
+                               "",
+                               PGC_USERSET,
+                               0,
+                               NULL,
+                               NULL,
+                               NULL);
+
+    DefineCustomBoolVariable("pg_chardetect.detect_language",
+                             "Report the language of ICU detection matches.",
+                             "Turning it off saves a lookup per detection; language is then NULL.",
+                             &detect_language,
+                             true,
+                             PGC_USERSET,
+                             0,
+                             NULL,
+                             NULL,
+                             NULL);
+
+    EmitWarningsOnPlaceholders("pg_chardetect");
+}
 
-    csd = ucsdet_open(&status);
+ChardetectState*
+get_chardetect_state(FunctionCallInfo fcinfo)
+{
+    ChardetectState* state = (ChardetectState*) fcinfo->flinfo->fn_extra;
 
-    // set text buffer
-    // use -1 for string length since NUL terminated
-    ucsdet_setText(csd, cbuffer, STRING_IS_NULL_TERMINATED, &status);
-    //ucsdet_setText(csd, cbuffer, cbuffer_len, &status);
+    if (NULL == state)
+    {
+        state = create_chardetect_state(fcinfo->flinfo->fn_mcxt);
+        fcinfo->flinfo->fn_extra = (void*) state;
+    }
 
-    // detect charset
-    csm = ucsdet_detect(csd, &status);
+    return state;
+}
 
-    // charset match is NULL if no match
-    if (NULL == csm)
-    {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("ICU error: No charset match for \"%s\" - assuming ISO-8859-1.", cbuffer)));
+ChardetectState*
+create_chardetect_state(MemoryContext context)
+{
+    ChardetectState* state;
 
-        *encoding = cstring_to_text("ISO-8859-1");
-        *lang = NULL;
-        *confidence = 0;
+    state = (ChardetectState*) MemoryContextAllocZero(context, sizeof(ChardetectState));
+    state->scratch = AllocSetContextCreate(context,
+                                           "pg_chardetect scratch",
+                                           ALLOCSET_DEFAULT_SIZES);
 
-        ucsdet_close(csd);
-        pfree((void *) cbuffer);
-        return status;
-    }
-    else if (U_FAILURE(status))
-    {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("ICU error: %s\n", u_errorName(status))));
+    // close the ICU objects when the owning context goes away
+    state->cleanup.func = chardetect_state_cleanup;
+    state->cleanup.arg = (void*) state;
+    MemoryContextRegisterResetCallback(context, &state->cleanup);
 
-        *encoding = NULL;
-        *lang = NULL;
-        *confidence = 0;
+    return state;
+}
 
-        ucsdet_close(csd);
-        pfree((void *) cbuffer);
-        return status;
-    }
+void
+chardetect_state_cleanup(void* arg)
+{
+    ChardetectState* state = (ChardetectState*) arg;
+    int i;
 
-    *encoding = cstring_to_text(ucsdet_getName(csm, &status));
-    *lang = cstring_to_text(ucsdet_getLanguage(csm, &status));
-    *confidence = ucsdet_getConfidence(csm, &status);
+    if (NULL != state->csd)
+        ucsdet_close(state->csd);
+    state->csd = NULL;
 
-    // close charset detector
-    // UCharsetMatch is owned by UCharsetDetector so its memory will be
-    // freed when the char set detector is closed
-    ucsdet_close(csd);
-    pfree((void *) cbuffer);
-    return status;
+    // closing a converter also frees its flag callback contexts
+    for (i = 0; i < state->nconverters; i++)
+        ucnv_close(state->converters[i].conv);
+    state->nconverters = 0;
 }
 
-UErrorCode
-convert_to_unicode(const text* buffer, const text* encoding, UChar** uBuf, int32_t *uBuf_len, bool force, bool* dropped_bytes)
+/*
+Returns the state's ICU detector, told the declared encoding.
+*/
+UCharsetDetector*
+get_detector(ChardetectState* state, UErrorCode* status)
 {
-    UErrorCode status = U_ZERO_ERROR;
+    const char* allowed;
+    const char* declared;
 
-    UConverter *conv;
-    int32_t uConvertedLen = 0;
+    if (NULL == state->csd)
+        state->csd = ucsdet_open(status);
 
-    // used to set dropped_bytes flag if force is true
-    ToUFLAGContext * context = NULL;
+    if (U_FAILURE(*status))
+        return NULL;
 
-    size_t uBufSize = 0;
+    // an empty name clears the declaration
+    detect_options(state, &allowed, &declared);
+    ucsdet_setDeclaredEncoding(state->csd, declared, strlen(declared), status);
 
-    const char* encoding_cstr = text_to_cstring(encoding);
+    return state->csd;
+}
 
-    // open converter for detected encoding
-    conv = ucnv_open(encoding_cstr, &status);
+/*
+The allowed charsets and declared encoding in effect: the per-call ones
+if set, pg_chardetect.allowed_charsets and declared_encoding otherwise.
+*/
+void
+detect_options(ChardetectState* state, const char** allowed, const char** declared)
+{
+    *allowed = (NULL != state->allowed_override) ? state->allowed_override : allowed_charsets;
+    *declared = (NULL != state->declared_override) ? state->declared_override : declared_encoding;
+
+    // unset while the settings are being defined
+    if (NULL == *allowed)
+        *allowed = "";
+    if (NULL == *declared)
+        *declared = "";
+}
 
-    if (U_FAILURE(status))
-    {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("Cannot open %s converter - error: %s.\n", (const char *) encoding_cstr, u_errorName(status))));
+/*
+Copies the next name of a comma separated list, without surrounding blanks,
+into name and returns where the rest of the list starts.
+*/
+const char*
+next_charset_name(const char* list, char* name, size_t size)
+{
+    size_t len = 0;
 
-        if (NULL != encoding_cstr)
-            pfree((void *) encoding_cstr);
+    while (' ' == *list || ',' == *list)
+        list++;
 
-        ucnv_close(conv);
-        return status;
+    while ('\0' != *list && ',' != *list)
+    {
+        if (len + 1 < size)
+            name[len++] = *list;
+        list++;
     }
 
-    if (force)
-    {
-        // set callback to skip illegal, irregular or unassigned bytes
+    while (len > 0 && ' ' == name[len - 1])
+        len--;
+    name[len] = '\0';
 
-        // set converter to use SKIP callback
-        // contecxt will save and call it after calling custom callback
-        ucnv_setToUCallBack(conv, UCNV_TO_U_CALLBACK_SKIP, NULL, NULL, NULL, &status);
+    return list;
+}
 
-        //TODO: refactor warning and error message reporting
-        if (U_FAILURE(status))
-        {
-            ereport(WARNING,
-                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-                 errmsg("Cannot set callback on converter - error: %s.\n", u_errorName(status))));
+/*
+True if charset name is in the comma separated list.  Names are compared
+as ICU does, ignoring case and punctuation.
+*/
+bool
+charset_in_list(const char* list, const char* name)
+{
+    char item[NAMEDATALEN];
 
-            if (NULL != encoding_cstr)
-                pfree((void *) encoding_cstr);
+    while ('\0' != *list)
+    {
+        list = next_charset_name(list, item, sizeof(item));
 
-            ucnv_close(conv);
-            return status;
-        }
+        if ('\0' != item[0] && 0 == ucnv_compareNames(item, name))
+            return true;
+    }
 
-        // initialize flagging callback
-        context = flagCB_toU_openContext();
+    return false;
+}
 
-        /* Set our special callback */
-        ucnv_setToUCallBack(conv,
-                            flagCB_toU,
-                            context,
-                            &(context->subCallback),
-                            &(context->subContext),
-                            &status
-                           );
+/*
+Checks every name in the comma separated list is a charset ICU knows; if
+not, copies the first unknown one into bad.
+*/
+bool
+check_charset_list(const char* list, char* bad, size_t size)
+{
+    char item[NAMEDATALEN];
 
-        if (U_FAILURE(status))
-        {
-            ereport(WARNING,
-                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-                 errmsg("Cannot set callback on converter - error: %s.\n", u_errorName(status))));
+    while ('\0' != *list)
+    {
+        UErrorCode status = U_ZERO_ERROR;
 
-            if (NULL != encoding_cstr)
-                pfree((void *) encoding_cstr);
+        list = next_charset_name(list, item, sizeof(item));
+        if ('\0' == item[0])
+            continue;
 
-            ucnv_close(conv);
-            return status;
+        if (0 == ucnv_countAliases(item, &status) || U_FAILURE(status))
+        {
+            strlcpy(bad, item, size);
+            return false;
         }
     }
 
-    // allocate unicode buffer
-    // must pfree before exiting calling function
-    uBufSize = (VARSIZE_ANY_EXHDR(buffer)/ucnv_getMinCharSize(conv) + 1);
-    *uBuf = (UChar*) palloc0(uBufSize * sizeof(UChar));
+    return true;
+}
+
+bool
+check_allowed_charsets(char** newval, void** extra, GucSource source)
+{
+    char bad[NAMEDATALEN];
 
-    if (*uBuf == NULL)
+    if (!check_charset_list(*newval, bad, sizeof(bad)))
     {
-        status = U_MEMORY_ALLOCATION_ERROR;
+        GUC_check_errdetail("\"%s\" is not a charset ICU knows.", bad);
+        return false;
+    }
 
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("Cannot allocate %d bytes for Unicode pivot buffer - error: %s.\n", (int) uBufSize, u_errorName(status))));
+    return true;
+}
 
-        if (NULL != encoding_cstr)
-            pfree((void *) encoding_cstr);
+/*
+Identifies the detector settings a detection result depends on, for the
+result cache.
+*/
+int32
+detect_cache_tag(ChardetectState* state)
+{
+    const char* allowed;
+    const char* declared;
+    uint32 tag = (uint32) detector_mode;
 
-        ucnv_close(conv);
-        return status;
-    }
+    detect_options(state, &allowed, &declared);
 
-    ereport(DEBUG1,
-        (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-            errmsg("Original string: %s\n", (const char*) text_to_cstring(buffer))));
-
-    // convert to Unicode
-    // returns length of converted string, not counting NUL-terminator
-    uConvertedLen = ucnv_toUChars(conv,
-                                  *uBuf,
-                                  uBufSize,
-                                  (const char*) text_to_cstring(buffer),
-                                  STRING_IS_NULL_TERMINATED,
-                                  &status
-                                 );
+    tag = hash_combine(tag, hash_bytes((const unsigned char*) allowed, strlen(allowed)));
+    tag = hash_combine(tag, hash_bytes((const unsigned char*) declared, strlen(declared)));
+    tag = hash_combine(tag, (uint32) detect_language);
 
-    if (U_SUCCESS(status))
-    {
-        // add 1 for NUL terminator
-        *uBuf_len = uConvertedLen + 1;
+    return (int32) tag;
+}
 
-        ereport(DEBUG1,
-            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-                errmsg("Converted string: %s\n", (const char*) *uBuf)));
+/*
+Returns a pooled converter for encoding name, reset and ready for a new
+conversion.  Converters are pooled by name and mode; in CONVERT_FORCE mode
+both callbacks skip bad bytes and the flag contexts are cleared here, in
+CONVERT_STRICT mode both stop at the first one.
+When the pool is full the least recently used converter is closed.
+*/
+ConverterEntry*
+get_converter(ChardetectState* state, const char* name, ConvertMode mode, UErrorCode* status)
+{
+    ConverterEntry* entry = NULL;
+    int i;
 
-        // see if any bytes where dropped
-        // context struct will go away with converter is closed
-        if (NULL != context)
-            *dropped_bytes = context->flag;
-        else
-            *dropped_bytes = false;
-    }
+    if (U_FAILURE(*status))
+        return NULL;
 
-    if (U_FAILURE(status))
+    for (i = 0; i < state->nconverters; i++)
     {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("ICU conversion from %s to Unicode failed - error: %s.\n", encoding_cstr, u_errorName(status))));
+        if (state->converters[i].mode == mode &&
+            0 == strcmp(state->converters[i].name, name))
+        {
+            entry = &state->converters[i];
+            break;
+        }
     }
 
-    if (NULL != encoding_cstr)
-        pfree((void *) encoding_cstr);
+    if (NULL == entry)
+    {
+        UConverter* conv;
 
-    ucnv_close(conv);
-    return status;
-}
+        if (strlen(name) >= UCNV_MAX_CONVERTER_NAME_LENGTH)
+        {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return NULL;
+        }
 
+        conv = ucnv_open(name, status);
 
-UErrorCode
-convert_to_utf8(const UChar* buffer, int32_t buffer_len, char** converted_buf, int32_t *converted_buf_len, bool force, bool* dropped_bytes)
-{
-    UErrorCode status = U_ZERO_ERROR;
-    UConverter *conv;
-    int32_t utfConvertedLen = 0;
+        if (U_FAILURE(*status))
+        {
+            ucnv_close(conv);
+            return NULL;
+        }
 
-    // used to set dropped_bytes flag if force is true
-    FromUFLAGContext * context = NULL;
+        if (state->nconverters < CONVERTER_POOL_SIZE)
+            entry = &state->converters[state->nconverters++];
+        else
+        {
+            // evict least recently used converter
+            entry = &state->converters[0];
+            for (i = 1; i < state->nconverters; i++)
+                if (state->converters[i].last_used < entry->last_used)
+                    entry = &state->converters[i];
 
-    // open UTF8 converter
-    conv = ucnv_open("utf-8", &status);
+            ucnv_close(entry->conv);
+        }
 
-    if (U_FAILURE(status))
-    {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("Cannot open utf-8 converter - error: %s.\n", u_errorName(status))));
+        memset(entry, 0, sizeof(ConverterEntry));
+        strlcpy(entry->name, name, UCNV_MAX_CONVERTER_NAME_LENGTH);
+        entry->mode = mode;
+        entry->conv = conv;
 
-        ucnv_close(conv);
-        return status;
-    }
+        if (CONVERT_STRICT == mode)
+        {
+            // ICU substitutes by default
+            ucnv_setToUCallBack(conv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, status);
+            ucnv_setFromUCallBack(conv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, status);
+        }
+        else if (CONVERT_FORCE == mode)
+        {
+            // set callbacks to skip illegal, irregular or unassigned bytes;
+            // the flag callbacks chain to SKIP and record that it fired
+            ucnv_setToUCallBack(conv, UCNV_TO_U_CALLBACK_SKIP, NULL, NULL, NULL, status);
+            ucnv_setFromUCallBack(conv, UCNV_FROM_U_CALLBACK_SKIP, NULL, NULL, NULL, status);
+
+            // a context belongs to the converter, which frees it on close,
+            // only once its callback is set; until then it is ours to free
+            if (U_SUCCESS(*status))
+            {
+                ToUFLAGContext* toU_context = flagCB_toU_openContext();
 
-    if (force)
-    {
-        // set callback to skip illegal, irregular or unassigned bytes
+                if (NULL == toU_context)
+                    *status = U_MEMORY_ALLOCATION_ERROR;
+                else
+                {
+                    ucnv_setToUCallBack(conv,
+                                        flagCB_toU,
+                                        toU_context,
+                                        &(toU_context->subCallback),
+                                        &(toU_context->subContext),
+                                        status
+                                       );
+
+                    if (U_SUCCESS(*status))
+                        entry->toU_context = toU_context;
+                    else
+                        free(toU_context);
+                }
+            }
+
+            if (U_SUCCESS(*status))
+            {
+                FromUFLAGContext* fromU_context = flagCB_fromU_openContext();
 
-        // set converter to use SKIP callback
-        // contecxt will save and call it after calling custom callback
-        ucnv_setFromUCallBack(conv, UCNV_FROM_U_CALLBACK_SKIP, NULL, NULL, NULL, &status);
+                if (NULL == fromU_context)
+                    *status = U_MEMORY_ALLOCATION_ERROR;
+                else
+                {
+                    ucnv_setFromUCallBack(conv,
+                                          flagCB_fromU,
+                                          fromU_context,
+                                          &(fromU_context->subCallback),
+                                          &(fromU_context->subContext),
+                                          status
+                                         );
+
+                    if (U_SUCCESS(*status))
+                        entry->fromU_context = fromU_context;
+                    else
+                        free(fromU_context);
+                }
+            }
+        }
 
-        //TODO: refactor warning and error message reporting
-        if (U_FAILURE(status))
+        if (U_FAILURE(*status))
         {
             ereport(WARNING,
                 (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-                 errmsg("Cannot set callback on converter - error: %s.\n", u_errorName(status))));
+                 errmsg("Cannot set callback on converter - error: %s.\n", u_errorName(*status))));
 
+            // drop the half-configured entry from the pool
             ucnv_close(conv);
-            return status;
+            *entry = state->converters[--state->nconverters];
+            return NULL;
         }
+    }
+    else
+        ucnv_reset(entry->conv);
 
-        // initialize flagging callback
-        context = flagCB_fromU_openContext();
+    if (NULL != entry->toU_context)
+        entry->toU_context->flag = false;
+    if (NULL != entry->fromU_context)
+        entry->fromU_context->flag = false;
 
-        /* Set our special callback */
-        ucnv_setFromUCallBack(conv,
-                              flagCB_fromU,
-                              context,
-                              &(context->subCallback),
-                              &(context->subContext),
-                              &status
-                             );
+    entry->last_used = ++state->use_count;
+    return entry;
+}
 
-        if (U_FAILURE(status))
-        {
-            ereport(WARNING,
-                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-                 errmsg("Cannot set callback on converter - error: %s.\n", u_errorName(status))));
+/*
+Maps a PostgreSQL encoding name or alias, e.g. LATIN1 or WIN1252, to ICU's
+name for it; any other name is passed to ICU as it is.  Returns NULL for a
+PostgreSQL encoding ICU has no converter for.
+*/
+const char*
+icu_encoding_name(const char* name)
+{
+    int         encoding = pg_char_to_encoding(name);
+    const char  *pg_name;
+    const EncodingName *entry;
 
-           ucnv_close(conv);
-            return status;
-        }
-    }
+    if (encoding < 0)
+        return name;
 
-    // convert to UTF8
-    // input buffer from ucnv_toUChars, which always returns a
-    // NUL-terminated buffer
-    utfConvertedLen = ucnv_fromUChars(conv,
-                                      *converted_buf,
-                                      *converted_buf_len,
-                                      buffer,
-                                      STRING_IS_NULL_TERMINATED,
-                                      &status
-                                     );
+    pg_name = pg_encoding_to_char(encoding);
 
-    if (U_SUCCESS(status))
+    for (entry = pg_icu_encodings; NULL != entry->pg_name; entry++)
+        if (0 == strcmp(entry->pg_name, pg_name))
+            return entry->icu_name;
+
+    return NULL;
+}
+
+/*
+Gets at most max_bytes bytes of the value in datum for detection.  Shorter
+values are used whole.  Otherwise only the leading slice, or detect_slices
+evenly spaced slices, are fetched, so a TOASTed value is never detoasted and
+decompressed in full.  Slice edges are trimmed to UTF8 character boundaries
+so a cut sequence does not make valid UTF8 look invalid.
+*/
+void
+get_detect_sample(Datum datum, int32 max_bytes, const char** sample, int32* sample_len)
+{
+    int32 total = toast_raw_datum_size(datum) - VARHDRSZ;
+    int32 nslices = detect_slices;
+    int32 slice_len;
+    StringInfoData buf;
+    text* slice;
+    int32 i;
+
+    if (max_bytes <= 0 || total <= max_bytes)
     {
-        *converted_buf_len = utfConvertedLen;
+        slice = DatumGetTextPP(datum);
+        *sample = VARDATA_ANY(slice);
+        *sample_len = VARSIZE_ANY_EXHDR(slice);
+        return;
+    }
 
-        ereport(DEBUG1,
-            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-                errmsg("Converted string: %s\n", (const char*) *converted_buf)));
+    nslices = Max(1, Min(nslices, max_bytes / MIN_DETECT_SLICE_BYTES));
+    slice_len = max_bytes / nslices;
 
-        // see if any bytes where dropped
-        // context struct will go away when converter is closed
-        if (NULL != context)
-            *dropped_bytes = context->flag;
-        else
-            *dropped_bytes = false;
+    if (1 == nslices)
+    {
+        slice = DatumGetTextPSlice(datum, 0, slice_len);
+        *sample = VARDATA_ANY(slice);
+        *sample_len = VARSIZE_ANY_EXHDR(slice) - utf8_partial_tail(VARDATA_ANY(slice), VARSIZE_ANY_EXHDR(slice));
+        return;
     }
 
-    if (U_FAILURE(status))
+    initStringInfo(&buf);
+
+    for (i = 0; i < nslices; i++)
     {
-        ereport(WARNING,
-            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-             errmsg("ICU conversion from Unicode to UTF8 failed - error: %s.\n", u_errorName(status))));
+        int32 offset = (int32) (((int64) (total - slice_len)) * i / (nslices - 1));
+        const char* data;
+        int32 len;
+        int32 head = 0;
+        int32 tail = 0;
+
+        slice = DatumGetTextPSlice(datum, offset, slice_len);
+        data = VARDATA_ANY(slice);
+        len = VARSIZE_ANY_EXHDR(slice);
+
+        if (offset > 0)
+            head = utf8_partial_head(data, len);
+        if (offset + len < total)
+            tail = utf8_partial_tail(data + head, len - head);
+
+        appendBinaryStringInfo(&buf, data + head, len - head - tail);
+        pfree(slice);
     }
 
-    // close the converter
-    ucnv_close(conv);
-    return status;
+    *sample = buf.data;
+    *sample_len = buf.len;
 }
 
 /*
-CREATE OR REPLACE FUNCTION public.convert_to_UTF8
-(
-IN  text_in text,
-IN  force   boolean,
-OUT text_out text,
-OUT converted boolean
-)
-AS 'MODULE_PATHNAME', 'char_set_detect'
-LANGUAGE C STRICT;
+Detects the charset of buffer.  Pure ASCII and strictly valid UTF8 are
+recognized by a byte scan and reported as UTF-8 with confidence 100 without
+calling ICU; everything else goes to detect_encoding(), through the result
+cache if it is enabled.
 */
+UErrorCode
+detect_charset(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence)
+{
+    CachedResult cached;
+    bool        cache = false;
+    UErrorCode  status;
 
-/* by reference, variable length */
-
-PG_FUNCTION_INFO_V1(convert_to_UTF8);
+    if (BYTES_OTHER != classify_bytes(buffer, buffer_len))
+    {
+        *encoding = cstring_to_text("UTF-8");
+        *lang = NULL;
+        *confidence = 100;
 
-Datum
-convert_to_UTF8(PG_FUNCTION_ARGS)
-{
-    // things we need to deal with constructing our composite type
-    TupleDesc   tupdesc;
-    Datum       values[3];
-    bool        nulls[3];
-    HeapTuple   tuple;
+        return U_ZERO_ERROR;
+    }
 
-    // for char_set_detect function returns
-    text    *encoding = NULL;
-    text    *lang = NULL;
-    int32_t confidence = 0;
+    if (result_cache_wanted(buffer_len))
+    {
+        if (result_cache_lookup(CACHE_DETECT, detect_cache_tag(state), buffer_len, buffer, buffer_len, &cached))
+        {
+            *encoding = cached.encoding;
+            *lang = cached.lang;
+            *confidence = cached.confidence;
 
-    UErrorCode status = U_ZERO_ERROR;
+            return U_ZERO_ERROR;
+        }
 
-    // output buffer for conversion to Unicode
-    UChar* uBuf = NULL;
-    int32_t uBuf_len = 0;
+        cache = true;
+    }
 
-    // output of this function
-    text *text_out;
-    bool converted = false;
-    bool dropped_bytes = false;
-    bool dropped_bytes_toU = false;
-    bool dropped_bytes_fromU = false;
+    status = detect_encoding(state, buffer, buffer_len, encoding, lang, confidence);
 
-    // temporary buffer for converted string
-    char* converted_buf = NULL;
+    if (cache && U_SUCCESS(status) && NULL != *encoding)
+    {
+        memset(&cached, 0, sizeof(cached));
+        cached.encoding = *encoding;
+        cached.lang = *lang;
+        cached.confidence = *confidence;
 
-    // input args
-    const text  *buffer = PG_GETARG_TEXT_P(0);
-    const bool  force   = PG_GETARG_BOOL(1);
+        result_cache_store(CACHE_DETECT, detect_cache_tag(state), buffer_len, buffer, buffer_len, &cached);
+    }
 
-    // C string of text* buffer
-    const char* cbuffer = NULL;
-    int cbuffer_len = 0;
+    return status;
+}
 
-    // Convert output values into a PostgreSQL composite type.
-    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
-        ereport(ERROR,
-            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
-              errmsg("function returning record called in context "
-                     "that cannot accept type record.\n")));
+/*
+Detects the charset of buffer, which is neither ASCII nor valid UTF8, with
+the detector pg_chardetect.detector selects.  The native detector settles
+UTF-8 (with a few bad bytes), windows-1252 and ISO-8859-1 in one pass over
+the bytes and reports no language; in hybrid mode ICU decides when the bytes
+do not fit any of those.  A native guess that is not an allowed charset, or
+not the declared one, is left to ICU as well.
+*/
+UErrorCode
+detect_encoding(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence)
+{
+    NativeGuess guess;
+    const char* allowed;
+    const char* declared;
 
-    // BlessTupleDesc for Datums
-    BlessTupleDesc(tupdesc);
+    detect_options(state, &allowed, &declared);
 
-    // return if string to convert is NULL
-    if (NULL == buffer)
+    if (DETECTOR_ICU != detector_mode)
     {
-        // return input string,
-        // converted to true,
-        // dropped_bytes to false
-        text_out = (text *) buffer;
-        converted = true;
-        dropped_bytes = false;
-    }
+        bool settled = native_detect(buffer, buffer_len, &guess);
+        const char* name = native_charset_name(guess.charset);
+
+        // the guess must be allowed, and agree with any declared encoding
+        if ((settled || DETECTOR_NATIVE == detector_mode) &&
+            ('\0' == *allowed || charset_in_list(allowed, name)) &&
+            ('\0' == *declared || 0 == ucnv_compareNames(declared, name)))
+        {
+            *encoding = cstring_to_text(name);
+            *lang = NULL;
+            *confidence = guess.confidence;
+
+            return U_ZERO_ERROR;
+        }
+
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("Native detection not conclusive - using ICU.\n")));
+    }
+
+    return detect_ICU(state, buffer, buffer_len, encoding, lang, confidence);
+}
+
+UErrorCode
+detect_ICU(ChardetectState* state, const char* buffer, int32_t buffer_len, text** encoding, text** lang, int32_t* confidence)
+{
+    UCharsetDetector* csd;
+    const UCharsetMatch* csm = NULL;
+    const UCharsetMatch** matches;
+    int32_t nmatches = 0;
+    int32_t i;
+    const char* allowed;
+    const char* declared;
+    UErrorCode status = U_ZERO_ERROR;
+
+    detect_options(state, &allowed, &declared);
+
+    // detector is reused across calls; setText resets it
+    csd = get_detector(state, &status);
+
+    if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU error: Cannot open charset detector - error: %s\n", u_errorName(status))));
+
+        *encoding = NULL;
+        *lang = NULL;
+        *confidence = 0;
+
+        return status;
+    }
+
+    // set text buffer
+    // the detector only keeps a pointer, so buffer must outlive the match
+    ucsdet_setText(csd, buffer, buffer_len, &status);
+
+    // detect charset; matches are sorted by confidence
+    matches = ucsdet_detectAll(csd, &nmatches, &status);
+
+    // ICU runs every recognizer whatever ucsdet_setDetectableCharset says,
+    // and reports names such as windows-1252 that are not recognizer names,
+    // so the matches are filtered instead: the best allowed match wins,
+    // unless the declared charset is plausible
+    for (i = 0; U_SUCCESS(status) && i < nmatches; i++)
+    {
+        const char* name = ucsdet_getName(matches[i], &status);
+
+        if ('\0' != *allowed && !charset_in_list(allowed, name))
+            continue;
+
+        if (NULL == csm)
+            csm = matches[i];
+
+        if ('\0' == *declared || 0 == ucnv_compareNames(name, declared))
+        {
+            if ('\0' != *declared)
+                csm = matches[i];
+            break;
+        }
+    }
+
+    // charset match is NULL if no match
+    if (NULL == csm)
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU error: No charset match for \"%.*s\" - assuming ISO-8859-1.", buffer_len, buffer)));
+
+        *encoding = cstring_to_text("ISO-8859-1");
+        *lang = NULL;
+        *confidence = 0;
+
+        return status;
+    }
+    else if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU error: %s\n", u_errorName(status))));
+
+        *encoding = NULL;
+        *lang = NULL;
+        *confidence = 0;
+
+        return status;
+    }
+
+    *encoding = cstring_to_text(ucsdet_getName(csm, &status));
+    *lang = detect_language ? cstring_to_text(ucsdet_getLanguage(csm, &status)) : NULL;
+    *confidence = ucsdet_getConfidence(csm, &status);
+
+    // UCharsetMatch is owned by the detector, which stays open in state;
+    // it is only valid until the next detection
+    return status;
+}
+
+/*
+Converts buffer from encoding straight to UTF8 with ucnv_convertEx, writing
+into a text varlena that grows geometrically.  ICU pivots through UTF-16 in a
+small fixed buffer, so there is no full-size intermediate copy.
+
+In CONVERT_FORCE mode both converters skip bad bytes and dropped_bytes
+reports whether either of them had to; in CONVERT_STRICT mode a bad byte
+fails the conversion.
+*/
+UErrorCode
+transcode_to_utf8(ChardetectState* state, const char* buffer, int32_t buffer_len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes)
+{
+    return transcode_chunks(state, buffer, (Datum) 0, buffer_len, encoding, mode, text_out, dropped_bytes);
+}
+
+/*
+Streaming variant of transcode_to_utf8() for a large value that is stored
+out of line and uncompressed.  The value is read STREAM_CHUNK_BYTES at a time
+with detoast slices and fed to the converters incrementally, so peak memory
+is the output plus one chunk, not the output plus the whole input.
+*/
+UErrorCode
+transcode_datum_to_utf8(ChardetectState* state, Datum datum, int32 datum_len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes)
+{
+    return transcode_chunks(state, NULL, datum, datum_len, encoding, mode, text_out, dropped_bytes);
+}
+
+/*
+Shared by the above: converts len bytes, taken from buffer if it is not
+NULL and from slices of datum otherwise.  Single byte charsets are converted
+natively by transcode_sbcs(); ICU handles everything else.
+*/
+UErrorCode
+transcode_chunks(ChardetectState* state, const char* buffer, Datum datum, int32 len, const char* encoding, ConvertMode mode, text** text_out, bool* dropped_bytes)
+{
+    const SbcsCharset *sbcs = sbcs_lookup(encoding);
+    UErrorCode status = U_ZERO_ERROR;
+
+    ConverterEntry *src;
+    ConverterEntry *utf8;
+
+    UChar pivot[PIVOT_BUFFER_SIZE];
+    UChar *pivot_source = pivot;
+    UChar *pivot_target = pivot;
+
+    UBool reset = true;
+    int32 offset = 0;
+
+    StringInfoData buf;
+
+    *text_out = NULL;
+    *dropped_bytes = false;
+
+    if (NULL != sbcs)
+        return transcode_sbcs(sbcs, buffer, datum, len, mode, text_out, dropped_bytes);
+
+    // get converter for detected encoding
+    // in force mode it skips illegal, irregular or unassigned bytes and
+    // flags them in its toU context
+    src = get_converter(state, encoding, mode, &status);
+
+    if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("Cannot open %s converter - error: %s.\n", encoding, u_errorName(status))));
+
+        return status;
+    }
+
+    utf8 = get_converter(state, "utf-8", mode, &status);
+
+    if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("Cannot open utf-8 converter - error: %s.\n", u_errorName(status))));
+
+        return status;
+    }
+
+    if (NULL != buffer && message_level_is_interesting(DEBUG1))
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+                errmsg("Original string: %.*s\n", len, buffer)));
+
+    // reserve the varlena header, then start with room for half again
+    // the input; most single byte text needs little more than that
+    initStringInfo(&buf);
+    enlargeStringInfo(&buf, (int) Min((Size) VARHDRSZ + len + len / 2, MaxAllocSize - 1));
+    buf.len = VARHDRSZ;
+
+    do
+    {
+        text *slice = NULL;
+        const char *source;
+        const char *source_limit;
+        char *target;
+
+        if (NULL != buffer)
+        {
+            source = buffer;
+            source_limit = buffer + len;
+        }
+        else
+        {
+            slice = DatumGetTextPSlice(datum, offset, Min(STREAM_CHUNK_BYTES, len - offset));
+            source = VARDATA_ANY(slice);
+            source_limit = source + VARSIZE_ANY_EXHDR(slice);
+
+            // guard against a value shorter than it claimed to be
+            if (source == source_limit)
+            {
+                status = U_TRUNCATED_CHAR_FOUND;
+                break;
+            }
+        }
+
+        offset += source_limit - source;
+
+        for (;;)
+        {
+            target = buf.data + buf.len;
+
+            // keep one byte free for the NUL terminator StringInfo expects;
+            // flush once the last chunk is in
+            ucnv_convertEx(utf8->conv,
+                           src->conv,
+                           &target,
+                           buf.data + buf.maxlen - 1,
+                           &source,
+                           source_limit,
+                           pivot,
+                           &pivot_source,
+                           &pivot_target,
+                           pivot + PIVOT_BUFFER_SIZE,
+                           reset,
+                           offset >= len,
+                           &status
+                          );
+
+            buf.len = target - buf.data;
+            reset = false;
+
+            if (U_BUFFER_OVERFLOW_ERROR != status)
+                break;
+
+            // out of room - double the buffer and carry on where ICU stopped,
+            // unless the result would outgrow a varlena
+            if ((Size) buf.maxlen >= MaxAllocSize)
+                break;
+
+            status = U_ZERO_ERROR;
+            enlargeStringInfo(&buf, (int) Min((Size) buf.len, MaxAllocSize - 1 - buf.len));
+        }
+
+        if (NULL != slice)
+            pfree(slice);
+
+    } while (U_SUCCESS(status) && offset < len);
+
+    if (U_FAILURE(status))
+    {
+        if (U_BUFFER_OVERFLOW_ERROR == status)
+            ereport(WARNING,
+                (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+                 errmsg("ICU conversion from %s to UTF8 failed - result exceeds the maximum text size.\n", encoding)));
+        // in strict mode bad bytes are an expected outcome the caller reports
+        else if (CONVERT_STRICT != mode ||
+                 (U_INVALID_CHAR_FOUND != status && U_ILLEGAL_CHAR_FOUND != status && U_TRUNCATED_CHAR_FOUND != status))
+            ereport(WARNING,
+                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                 errmsg("ICU conversion from %s to UTF8 failed - error: %s.\n", encoding, u_errorName(status))));
+
+        pfree(buf.data);
+        return status;
+    }
+
+    SET_VARSIZE(buf.data, buf.len);
+    *text_out = (text *) buf.data;
+
+    if (message_level_is_interesting(DEBUG1))
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+                errmsg("Converted string: %.*s\n", (int) VARSIZE_ANY_EXHDR(*text_out), VARDATA(*text_out))));
+
+    // see if any bytes where dropped
+    *dropped_bytes = ((NULL != src->toU_context && src->toU_context->flag) ||
+                      (NULL != utf8->fromU_context && utf8->fromU_context->flag));
+
+    // a full buffer leaves U_STRING_NOT_TERMINATED_WARNING behind, which
+    // does not matter for a varlena
+    return U_ZERO_ERROR;
+}
+
+/*
+Converts a single byte charset with the tables in sbcs_tables.c, which
+reproduce ICU's mapping, default substitutions and force mode flagging.
+In CONVERT_STRICT mode a byte ICU would flag fails the conversion.
+In-memory input is converted into an exactly sized varlena after a
+counting pass; streamed input is converted chunk by chunk.
+*/
+UErrorCode
+transcode_sbcs(const SbcsCharset* sbcs, const char* buffer, Datum datum, int32 len, ConvertMode mode, text** text_out, bool* dropped_bytes)
+{
+    StringInfoData buf;
+    int32 offset = 0;
+    bool force = (CONVERT_FORCE == mode);
+
+    initStringInfo(&buf);
+    buf.len = VARHDRSZ;
+
+    do
+    {
+        text *slice = NULL;
+        const char *source = buffer;
+        int32 source_len = len;
+        size_t out_len;
+        bool dropped = false;
+
+        if (NULL == buffer)
+        {
+            slice = DatumGetTextPSlice(datum, offset, Min(STREAM_CHUNK_BYTES, len - offset));
+            source = VARDATA_ANY(slice);
+            source_len = VARSIZE_ANY_EXHDR(slice);
+
+            // guard against a value shorter than it claimed to be
+            if (0 == source_len)
+            {
+                pfree(buf.data);
+                return U_TRUNCATED_CHAR_FOUND;
+            }
+        }
+
+        offset += source_len;
+
+        if (CONVERT_STRICT == mode && sbcs_flagged_offset(sbcs, source, source_len) < (size_t) source_len)
+        {
+            if (NULL != slice)
+                pfree(slice);
+            pfree(buf.data);
+            return U_INVALID_CHAR_FOUND;
+        }
+
+        out_len = sbcs_utf8_len(sbcs, source, source_len, force);
+
+        if (out_len + SBCS_OUTPUT_SLACK >= MaxAllocSize - buf.len)
+        {
+            ereport(WARNING,
+                (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+                 errmsg("Conversion from %s to UTF8 failed - result exceeds the maximum text size.\n", sbcs->name)));
+
+            pfree(buf.data);
+            return U_BUFFER_OVERFLOW_ERROR;
+        }
+
+        enlargeStringInfo(&buf, out_len + SBCS_OUTPUT_SLACK);
+        buf.len += sbcs_to_utf8(sbcs, source, source_len, force, buf.data + buf.len, &dropped);
+        *dropped_bytes = *dropped_bytes || dropped;
+
+        if (NULL != slice)
+            pfree(slice);
+
+    } while (offset < len);
+
+    SET_VARSIZE(buf.data, buf.len);
+    *text_out = (text *) buf.data;
+
+    return U_ZERO_ERROR;
+}
+
+/*
+Converts len bytes of buffer to UTF8 in one pass: runs of valid UTF8 are
+copied, and the spans of bytes between them are converted from single byte
+charset sbcs, dropping the bytes it has no character for if force is set.
+*/
+UErrorCode
+transcode_mixed(const SbcsCharset* sbcs, const char* buffer, int32 len, bool force, text** text_out, bool* dropped_bytes)
+{
+    StringInfoData buf;
+    int32 offset = 0;
+    size_t run;
+    bool is_ascii;
+
+    initStringInfo(&buf);
+    buf.len = VARHDRSZ;
+
+    run = utf8_valid_prefix(buffer, len, &is_ascii);
+
+    for (;;)
+    {
+        int32 span_start;
+        size_t out_len;
+        bool dropped = false;
+
+        appendBinaryStringInfo(&buf, buffer + offset, run);
+        offset += run;
+
+        if (offset >= len)
+            break;
+
+        // the span ends where valid UTF8 starts again
+        span_start = offset;
+        do
+        {
+            offset++;
+            run = (offset < len) ? utf8_valid_prefix(buffer + offset, len - offset, &is_ascii) : 0;
+        } while (offset < len && 0 == run);
+
+        out_len = sbcs_utf8_len(sbcs, buffer + span_start, offset - span_start, force);
+
+        if (out_len + SBCS_OUTPUT_SLACK >= MaxAllocSize - buf.len)
+        {
+            pfree(buf.data);
+            return U_BUFFER_OVERFLOW_ERROR;
+        }
+
+        enlargeStringInfo(&buf, out_len + SBCS_OUTPUT_SLACK);
+        buf.len += sbcs_to_utf8(sbcs, buffer + span_start, offset - span_start, force, buf.data + buf.len, &dropped);
+        *dropped_bytes = *dropped_bytes || dropped;
+    }
+
+    SET_VARSIZE(buf.data, buf.len);
+    *text_out = (text *) buf.data;
+
+    return U_ZERO_ERROR;
+}
+
+/*
+Returns true if datum is a value stored out of line without compression,
+so slices of it can be read without detoasting the rest.
+*/
+bool
+datum_is_streamable(Datum datum)
+{
+    struct varlena* attr = (struct varlena*) DatumGetPointer(datum);
+    struct varatt_external toast_pointer;
+
+    if (!VARATT_IS_EXTERNAL_ONDISK(attr))
+        return false;
+
+    VARATT_EXTERNAL_GET_POINTER(toast_pointer, attr);
+    return !VARATT_EXTERNAL_IS_COMPRESSED(toast_pointer);
+}
+
+/*
+classify_bytes() for a value read STREAM_CHUNK_BYTES at a time.  A multibyte
+sequence cut at the end of a chunk is validated again with the next one.
+*/
+ByteClass
+classify_datum(Datum datum, int32 datum_len)
+{
+    int32 offset = 0;
+    bool all_ascii = true;
+
+    while (offset < datum_len)
+    {
+        text* slice = DatumGetTextPSlice(datum, offset, Min(STREAM_CHUNK_BYTES, datum_len - offset));
+        const char* data = VARDATA_ANY(slice);
+        int32 slice_len = VARSIZE_ANY_EXHDR(slice);
+        bool ascii;
+        int32 valid = utf8_valid_prefix(data, slice_len, &ascii);
+
+        all_ascii = all_ascii && ascii;
+
+        if (valid < slice_len &&
+            (offset + slice_len >= datum_len ||
+             (size_t) (slice_len - valid) != utf8_partial_tail(data, slice_len)))
+        {
+            pfree(slice);
+            return BYTES_OTHER;
+        }
+
+        pfree(slice);
+        offset += valid;
+    }
+
+    return all_ascii ? BYTES_ASCII : BYTES_UTF8;
+}
+
+/*
+Converts one value to UTF8 and fills in result.  text_out is left NULL when
+the input should be returned as it is: when it is empty, already ASCII or
+valid UTF8, detected as UTF8, or cannot be converted.
+
+Values larger than pg_chardetect.stream_threshold that are stored out of
+line uncompressed are classified, detected and converted from detoast
+slices instead of being detoasted whole.
+*/
+void
+convert_datum(ChardetectState* state, Datum value, bool force, ConvertResult* result)
+{
+    int32 len = toast_raw_datum_size(value) - VARHDRSZ;
+    text* buffer;
+
+    if (stream_threshold > 0 && len > stream_threshold && datum_is_streamable(value))
+    {
+        const char* sample;
+        int32 sample_len;
+        text* encoding = NULL;
+        text* lang = NULL;
+        int32_t confidence = 0;
+        UErrorCode status;
+
+        result->text_out = NULL;
+        result->converted = true;
+        result->dropped_bytes = false;
+
+        if (BYTES_OTHER != classify_datum(value, len))
+            return;
+
+        // never detect from the whole of a value this size
+        get_detect_sample(value, (max_detect_bytes > 0) ? max_detect_bytes : STREAM_CHUNK_BYTES, &sample, &sample_len);
+        status = detect_encoding(state, sample, sample_len, &encoding, &lang, &confidence);
+
+        convert_detected(state, NULL, value, len, status, encoding, force, result);
+        return;
+    }
+
+    buffer = DatumGetTextPP(value);
+    convert_buffer(state, VARDATA_ANY(buffer), VARSIZE_ANY_EXHDR(buffer), force, result);
+}
+
+/*
+convert_datum() for a value of a column with a decision in
+pg_chardetect_column_encoding: values of a COLUMN_SKIP column are kept,
+and those of a COLUMN_CONVERT column that are not ASCII or valid UTF8 are
+converted from the known encoding without detection.
+*/
+void
+convert_column(ChardetectState* state, Datum value, const ColumnDecision* decision, bool force, ConvertResult* result)
+{
+    int32 len;
+    text* buffer;
+
+    if (COLUMN_DETECT == decision->policy)
+    {
+        convert_datum(state, value, force, result);
+        return;
+    }
+
+    result->text_out = NULL;
+    result->converted = (COLUMN_CONVERT == decision->policy);
+    result->dropped_bytes = false;
+
+    if (COLUMN_SKIP == decision->policy)
+        return;
+
+    len = toast_raw_datum_size(value) - VARHDRSZ;
+
+    if (stream_threshold > 0 && len > stream_threshold && datum_is_streamable(value))
+    {
+        if (BYTES_OTHER == classify_datum(value, len))
+            convert_detected(state, NULL, value, len, U_ZERO_ERROR, cstring_to_text(decision->encoding), force, result);
+        return;
+    }
+
+    buffer = DatumGetTextPP(value);
+
+    if (len > 0 && BYTES_OTHER == classify_bytes(VARDATA_ANY(buffer), len))
+        convert_detected(state, VARDATA_ANY(buffer), (Datum) 0, len, U_ZERO_ERROR, cstring_to_text(decision->encoding), force, result);
+}
+
+/*
+convert_datum() for a value already in memory.  Results for values that
+need detection are looked up in and added to the result cache.
+*/
+void
+convert_buffer(ChardetectState* state, const char* buffer, int32 len, bool force, ConvertResult* result)
+{
+    text* encoding = NULL;
+    text* lang = NULL;
+    int32_t confidence = 0;
+    int32 detect_len = len;
+    UErrorCode status;
+    CacheKind kind = force ? CACHE_CONVERT_FORCE : CACHE_CONVERT;
+    CachedResult cached;
+    bool cache = false;
+
+    result->text_out = NULL;
+    result->converted = true;
+    result->dropped_bytes = false;
+
+    // bail on zero-length strings
+    if (0 == len)
+        return;
+
+    // ASCII and valid UTF8 need neither detection nor conversion
+    if (BYTES_OTHER != classify_bytes(buffer, len))
+    {
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("Input is valid UTF8.  No conversion necessary.\n")));
+        return;
+    }
+
+    // detect encoding, from at most max_detect_bytes
+    if (max_detect_bytes > 0 && detect_len > max_detect_bytes)
+        detect_len = max_detect_bytes - utf8_partial_tail(buffer, max_detect_bytes);
+
+    if (result_cache_wanted(len))
+    {
+        if (result_cache_lookup(kind, detect_cache_tag(state), detect_len, buffer, len, &cached))
+        {
+            result->text_out = cached.text_out;
+            result->converted = cached.converted;
+            result->dropped_bytes = cached.dropped_bytes;
+            return;
+        }
+
+        cache = true;
+    }
+
+    status = detect_encoding(state, buffer, detect_len, &encoding, &lang, &confidence);
+
+    ereport(DEBUG1,
+        (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+         errmsg("Detection status: %d\n", status)));
+
+    convert_detected(state, buffer, (Datum) 0, len, status, encoding, force, result);
+
+    if (NULL != lang)
+        pfree(lang);
+
+    // failures are not cached, so they are reported every time
+    if (cache && result->converted)
+    {
+        memset(&cached, 0, sizeof(cached));
+        cached.text_out = result->text_out;
+        cached.converted = result->converted;
+        cached.dropped_bytes = result->dropped_bytes;
+
+        result_cache_store(kind, detect_cache_tag(state), detect_len, buffer, len, &cached);
+    }
+}
+
+/*
+Converts the strings of one structured value, the keys and strings of a
+jsonb document or the elements of a text array, into results.  Strings
+that are ASCII or valid UTF8 are kept without detection.  The others that
+are shorter than MIN_DETECT_SLICE_BYTES give the detector little to go on
+one at a time and usually share a source, so they are pooled, newline
+separated, up to max_detect_bytes (64kB if that is 0) and detected once;
+longer ones are detected on their own.  A NULL leaf is skipped.
+*/
+void
+convert_leaves(ChardetectState* state, int nleaves, const char** leaves, const int32* lens, bool force, ConvertResult* results)
+{
+    int32       pool_max = (max_detect_bytes > 0) ? max_detect_bytes : DEFAULT_DETECT_AGG_BYTES;
+    bool        *pooled = palloc0(Max(nleaves, 1) * sizeof(bool));
+    StringInfoData pool;
+    text        *encoding = NULL;
+    text        *lang = NULL;
+    int32_t     confidence = 0;
+    UErrorCode  status;
+    int         i;
+
+    initStringInfo(&pool);
+
+    for (i = 0; i < nleaves; i++)
+    {
+        results[i].text_out = NULL;
+        results[i].converted = true;
+        results[i].dropped_bytes = false;
+
+        if (NULL == leaves[i] || 0 == lens[i] || BYTES_OTHER != classify_bytes(leaves[i], lens[i]))
+            continue;
+
+        if (lens[i] >= MIN_DETECT_SLICE_BYTES)
+        {
+            convert_buffer(state, leaves[i], lens[i], force, &results[i]);
+            continue;
+        }
+
+        pooled[i] = true;
+
+        // once the pool is full the rest only share its verdict
+        if (pool.len < pool_max)
+        {
+            if (pool.len > 0)
+                appendStringInfoChar(&pool, '\n');
+            appendBinaryStringInfo(&pool, leaves[i], Min(lens[i], pool_max - pool.len));
+        }
+    }
+
+    if (pool.len > 0)
+    {
+        status = detect_charset(state, pool.data, pool.len, &encoding, &lang, &confidence);
+
+        // convert_detected() frees the encoding it is given
+        for (i = 0; i < nleaves; i++)
+            if (pooled[i])
+                convert_detected(state, leaves[i], (Datum) 0, lens[i], status,
+                                 (NULL != encoding) ? copy_text(encoding) : NULL, force, &results[i]);
+    }
+
+    if (NULL != encoding)
+        pfree(encoding);
+    if (NULL != lang)
+        pfree(lang);
+    pfree(pool.data);
+    pfree(pooled);
+}
+
+/*
+Second half of convert_datum(): converts the value from the encoding
+detect_encoding() returned, reading it from buffer, or from slices of datum if
+buffer is NULL.  Frees encoding.
+*/
+void
+convert_detected(ChardetectState* state, const char* buffer, Datum datum, int32 len, UErrorCode status, text* encoding, bool force, ConvertResult* result)
+{
+    char* encoding_cstr;
+    ConvertMode mode = force ? CONVERT_FORCE : CONVERT_SUBSTITUTE;
+
+    result->text_out = NULL;
+    result->converted = false;
+    result->dropped_bytes = false;
+
+    if (U_FAILURE(status) || NULL == encoding)
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                errmsg("ICU detection failed - returning original input")));
+        return;
+    }
+
+    encoding_cstr = text_to_cstring(encoding);
+    pfree(encoding);
+
+    ereport(DEBUG1,
+        (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+         errmsg("Detected encoding: %s\n", encoding_cstr)));
+
+    // return without attempting a conversion if UTF8 is detected
+    if (0 == pg_strcasecmp("UTF-8", encoding_cstr) ||
+        0 == pg_strcasecmp("UTF8", encoding_cstr))
+    {
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("ICU detected %s.  No conversion necessary.\n", encoding_cstr)));
+
+        result->converted = true;
+        pfree(encoding_cstr);
+        return;
+    }
+
+    // convert from the detected encoding straight to UTF8
+    if (NULL != buffer)
+        status = transcode_to_utf8(state, buffer, len, encoding_cstr, mode, &result->text_out, &result->dropped_bytes);
+    else
+        status = transcode_datum_to_utf8(state, datum, len, encoding_cstr, mode, &result->text_out, &result->dropped_bytes);
+
+    if (U_SUCCESS(status))
+        result->converted = true;
+    else
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                errmsg("ICU conversion failed - returning original input")));
+
+        result->text_out = NULL;
+        result->dropped_bytes = false;
+    }
+
+    pfree(encoding_cstr);
+}
+
+/*
+CREATE OR REPLACE FUNCTION public.convert_to_UTF8
+(
+IN  text_in text,
+IN  force   boolean,
+OUT text_out text,
+OUT converted boolean
+)
+AS 'MODULE_PATHNAME', 'char_set_detect'
+LANGUAGE C STRICT;
+*/
+
+/* by reference, variable length */
+
+PG_FUNCTION_INFO_V1(convert_to_UTF8);
+
+Datum
+convert_to_UTF8(PG_FUNCTION_ARGS)
+{
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    // output of this function
+    ConvertResult result;
+    MemoryContext oldcontext;
+    Datum       tuple;
+
+    // input args; the four argument form names the column value is from
+    const Datum value   = PG_GETARG_DATUM(0);
+    const bool  force   = PG_GETARG_BOOL(PG_NARGS() - 1);
+    Datum       value_out = value;
+
+    // detoasted copies, detection results and the converted text all go
+    // away with the scratch context once the row holds its own copy
+    oldcontext = MemoryContextSwitchTo(state->scratch);
+
+    if (4 == PG_NARGS())
+    {
+        Oid         relid = PG_GETARG_OID(1);
+        char        *attname = NameStr(*PG_GETARG_NAME(2));
+        AttrNumber  attnum = get_attnum(relid, attname);
+        ColumnDecision decision;
+
+        if (InvalidAttrNumber == attnum)
+            ereport(ERROR,
+                (errcode(ERRCODE_UNDEFINED_COLUMN),
+                 errmsg("convert_to_UTF8: column \"%s\" of relation \"%s\" does not exist",
+                        attname, get_rel_name(relid))));
+
+        column_decision_lookup(relid, attnum, &decision);
+        convert_column(state, value, &decision, force, &result);
+    }
+    else
+        convert_datum(state, value, force, &result);
+
+    // raw bytes are only returned as text once known to be valid UTF8
+    if (2 == PG_NARGS() && BYTEAOID == get_fn_expr_argtype(fcinfo->flinfo, 0))
+        value_out = check_bytea_result(value, force, &result);
+
+    MemoryContextSwitchTo(oldcontext);
+
+    tuple = convert_result_tuple(fcinfo, value_out, &result);
+    MemoryContextReset(state->scratch);
+
+    return tuple;
+}
+
+/*
+convert_to_UTF8(bytea, boolean) returns text, but unlike text input the
+bytes are not known to be valid in the database encoding.  ICU and the
+single byte tables both map 0x00 to U+0000, so NUL characters in the result
+are dropped in force mode, setting dropped_bytes, and make the conversion
+fail otherwise.  The input is only kept as the result if it is valid UTF8.
+Returns value, or (Datum) 0 for a NULL text_out if the bytes could not be
+converted.
+*/
+Datum
+check_bytea_result(Datum value, bool force, ConvertResult* result)
+{
+    if (NULL != result->text_out)
+    {
+        char    *data = VARDATA_ANY(result->text_out);
+        int32   len = VARSIZE_ANY_EXHDR(result->text_out);
+        int32   i;
+        int32   o = 0;
+
+        if (NULL == memchr(data, '\0', len))
+            return value;
+
+        if (force)
+        {
+            for (i = 0; i < len; i++)
+                if ('\0' != data[i])
+                    data[o++] = data[i];
+
+            SET_VARSIZE(result->text_out, VARHDRSZ + o);
+            result->dropped_bytes = true;
+            return value;
+        }
+
+        ereport(WARNING,
+            (errcode(ERRCODE_CHARACTER_NOT_IN_REPERTOIRE),
+             errmsg("Cannot convert bytes to UTF8 - the result holds NUL characters.")));
+
+        pfree(result->text_out);
+        result->text_out = NULL;
+    }
+    else if (result->converted &&
+             BYTES_OTHER != classify_datum(value, toast_raw_datum_size(value) - VARHDRSZ))
+        return value;
+
+    result->converted = false;
+    result->dropped_bytes = false;
+
+    return (Datum) 0;
+}
+
+/*
+convert_to_UTF8(text, boolean, text): converts as convert_to_UTF8(text,
+boolean) does, then normalizes the UTF8 to form in the same call instead of
+a separate normalize() pass over the value.
+*/
+PG_FUNCTION_INFO_V1(convert_to_UTF8_normalized);
+
+Datum
+convert_to_UTF8_normalized(PG_FUNCTION_ARGS)
+{
+    ChardetectState *state = get_chardetect_state(fcinfo);
+    ConvertResult result;
+
+    const Datum value   = PG_GETARG_DATUM(0);
+    const bool  force   = PG_GETARG_BOOL(1);
+    UChar32     quick_below;
+    const UNormalizer2* normalizer = get_normalizer(text_to_cstring(PG_GETARG_TEXT_PP(2)), &quick_below);
+    MemoryContext oldcontext;
+    Datum       tuple;
+
+    oldcontext = MemoryContextSwitchTo(state->scratch);
+
+    convert_datum(state, value, force, &result);
+
+    // input that could not be converted is not UTF8 and is kept as it is
+    if (result.converted)
+    {
+        text *buffer = (NULL != result.text_out) ? result.text_out : DatumGetTextPP(value);
+        text *normalized = normalize_utf8(normalizer, quick_below, VARDATA_ANY(buffer), VARSIZE_ANY_EXHDR(buffer));
+
+        if (NULL != normalized)
+        {
+            if (NULL != result.text_out)
+                pfree(result.text_out);
+            result.text_out = normalized;
+        }
+    }
+
+    MemoryContextSwitchTo(oldcontext);
+
+    tuple = convert_result_tuple(fcinfo, value, &result);
+    MemoryContextReset(state->scratch);
+
+    return tuple;
+}
+
+/*
+convert_mixed_to_UTF8(text, boolean, text): values put together from
+several sources may hold valid UTF8 and single byte text side by side.
+One scan keeps every maximal run of valid UTF8 as it is and converts only
+the spans between them, from the fallback charset, without detecting each
+span.  Single byte text that happens to form valid UTF8 sequences is kept
+as UTF8.
+*/
+PG_FUNCTION_INFO_V1(convert_mixed_to_UTF8);
+
+Datum
+convert_mixed_to_UTF8(PG_FUNCTION_ARGS)
+{
+    ChardetectState *state = get_chardetect_state(fcinfo);
+    ConvertResult result;
+
+    const Datum value   = PG_GETARG_DATUM(0);
+    const bool  force   = PG_GETARG_BOOL(1);
+    char        *fallback = text_to_cstring(PG_GETARG_TEXT_PP(2));
+    text        *buffer;
+    int32       len;
+    const SbcsCharset *sbcs;
+    UErrorCode  status;
+    MemoryContext oldcontext;
+    Datum       tuple;
+
+    oldcontext = MemoryContextSwitchTo(state->scratch);
+
+    buffer = DatumGetTextPP(value);
+    len = VARSIZE_ANY_EXHDR(buffer);
+
+    result.text_out = NULL;
+    result.converted = true;
+    result.dropped_bytes = false;
+
+    if (BYTES_OTHER != classify_bytes(VARDATA_ANY(buffer), len))
+    {
+        MemoryContextSwitchTo(oldcontext);
+        MemoryContextReset(state->scratch);
+        return convert_result_tuple(fcinfo, value, &result);
+    }
+
+    sbcs = mixed_fallback_charset(state, value, fallback);
+    status = transcode_mixed(sbcs, VARDATA_ANY(buffer), len, force, &result.text_out, &result.dropped_bytes);
+
+    if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_CHARACTER_NOT_IN_REPERTOIRE),
+             errmsg("Cannot convert text from UTF8 and %s to UTF8 - returning original input.", sbcs->name)));
+
+        result.converted = false;
+        result.dropped_bytes = false;
+    }
+
+    MemoryContextSwitchTo(oldcontext);
+
+    tuple = convert_result_tuple(fcinfo, value, &result);
+    MemoryContextReset(state->scratch);
+
+    return tuple;
+}
+
+/*
+Single byte charset for the spans of value that are not UTF8: fallback, a
+PostgreSQL or ICU name, or if it is empty the charset detected once from
+value, windows-1252 if that is not a single byte charset.
+*/
+const SbcsCharset*
+mixed_fallback_charset(ChardetectState* state, Datum value, const char* fallback)
+{
+    const SbcsCharset *sbcs = NULL;
+    const char  *name;
+    UErrorCode  status = U_ZERO_ERROR;
+
+    if ('\0' != *fallback)
+    {
+        name = icu_encoding_name(fallback);
+
+        if (NULL != name)
+            sbcs = sbcs_lookup(name);
+
+        // ICU aliases such as cp1252
+        if (NULL == sbcs && NULL != name)
+        {
+            const char *standard = ucnv_getStandardName(name, "IANA", &status);
+
+            if (U_SUCCESS(status) && NULL != standard)
+                sbcs = sbcs_lookup(standard);
+        }
+
+        if (NULL == sbcs)
+            ereport(ERROR,
+                (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+                 errmsg("convert_mixed_to_UTF8: %s is not a supported single byte charset", fallback)));
+    }
+    else
+    {
+        text        *encoding = NULL;
+        text        *lang = NULL;
+        int32_t     confidence = 0;
+
+        detect_value(state, value, max_detect_bytes, &encoding, &lang, &confidence, NULL);
+
+        if (NULL != encoding)
+            sbcs = sbcs_lookup(text_to_cstring(encoding));
+
+        if (NULL == sbcs)
+            sbcs = sbcs_lookup("windows-1252");
+    }
+
+    return sbcs;
+}
+
+/*
+Returns ICU's normalizer for normalization form NFC, NFD, NFKC or NFKD, and
+in quick_below the code point below which every character is already in
+that form.
+*/
+const UNormalizer2*
+get_normalizer(const char* form, UChar32* quick_below)
+{
+    const UNormalizer2* normalizer = NULL;
+    UErrorCode status = U_ZERO_ERROR;
+
+    if (0 == pg_strcasecmp(form, "NFC"))
+    {
+        normalizer = unorm2_getNFCInstance(&status);
+        *quick_below = 0x0300;
+    }
+    else if (0 == pg_strcasecmp(form, "NFD"))
+    {
+        normalizer = unorm2_getNFDInstance(&status);
+        *quick_below = 0x00C0;
+    }
+    else if (0 == pg_strcasecmp(form, "NFKC"))
+    {
+        normalizer = unorm2_getNFKCInstance(&status);
+        *quick_below = 0x00A0;
+    }
+    else if (0 == pg_strcasecmp(form, "NFKD"))
+    {
+        normalizer = unorm2_getNFKDInstance(&status);
+        *quick_below = 0x00A0;
+    }
+    else
+        ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("invalid normalization form: %s", form)));
+
+    if (U_FAILURE(status))
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU error: Cannot open %s normalizer - error: %s", form, u_errorName(status))));
+
+    return normalizer;
+}
+
+/*
+Normalizes len bytes of UTF8 in buffer, returning a new text value, or
+NULL if the text is already normalized, or with a warning if it is too
+large to normalize in memory.  Text made only of characters
+below quick_below is recognized from the UTF8 bytes.  Otherwise the text is
+decoded to UTF-16 once, the normalized prefix found with
+unorm2_spanQuickCheckYes() is copied and only the rest is normalized.
+Bytes that are not valid UTF8 are left alone.
+*/
+text*
+normalize_utf8(const UNormalizer2* normalizer, UChar32 quick_below, const char* buffer, int32 len)
+{
+    UChar       *source;
+    UChar       *dest;
+    int32_t     source_len;
+    int32_t     span;
+    int32_t     dest_len;
+    int32_t     dest_capacity;
+    int32_t     out_len;
+    text        *out;
+    UErrorCode  status = U_ZERO_ERROR;
+
+    if (utf8_all_below(buffer, len, quick_below))
+        return NULL;
+
+    // UTF8 never needs more UTF-16 code units than it has bytes
+    if ((Size) len * sizeof(UChar) >= MaxAllocSize)
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+             errmsg("ICU normalization skipped - text exceeds the maximum size that can be normalized.\n")));
+        return NULL;
+    }
+
+    source = palloc(Max(len, 1) * sizeof(UChar));
+    u_strFromUTF8(source, Max(len, 1), &source_len, buffer, len, &status);
+
+    if (U_FAILURE(status))
+    {
+        pfree(source);
+        return NULL;
+    }
+
+    span = unorm2_spanQuickCheckYes(normalizer, source, source_len, &status);
+
+    if (U_FAILURE(status) || span == source_len)
+    {
+        pfree(source);
+        return NULL;
+    }
+
+    // the prefix is normalized already; normalize the rest after it, with
+    // room for some growth, retrying once at the size ICU asks for
+    dest_capacity = source_len + source_len / 2 + 16;
+
+    for (;;)
+    {
+        if ((Size) dest_capacity * sizeof(UChar) >= MaxAllocSize)
+        {
+            ereport(WARNING,
+                (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+                 errmsg("ICU normalization skipped - text exceeds the maximum size that can be normalized.\n")));
+
+            pfree(source);
+            return NULL;
+        }
+
+        dest = palloc(dest_capacity * sizeof(UChar));
+        memcpy(dest, source, span * sizeof(UChar));
+
+        dest_len = unorm2_normalizeSecondAndAppend(normalizer, dest, span, dest_capacity,
+                                                   source + span, source_len - span, &status);
+
+        if (U_BUFFER_OVERFLOW_ERROR != status)
+            break;
+
+        pfree(dest);
+        status = U_ZERO_ERROR;
+        dest_capacity = dest_len + 1;
+    }
+
+    pfree(source);
+
+    if (U_FAILURE(status))
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU normalization failed - error: %s.\n", u_errorName(status))));
+
+        pfree(dest);
+        return NULL;
+    }
+
+    // measure, then write the UTF8 straight into the varlena
+    u_strToUTF8(NULL, 0, &out_len, dest, dest_len, &status);
+
+    if (U_BUFFER_OVERFLOW_ERROR == status)
+        status = U_ZERO_ERROR;
+
+    if ((Size) VARHDRSZ + out_len + 1 >= MaxAllocSize)
+    {
+        ereport(WARNING,
+            (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+             errmsg("ICU normalization skipped - result exceeds the maximum text size.\n")));
+
+        pfree(dest);
+        return NULL;
+    }
+
+    out = (text *) palloc(VARHDRSZ + out_len + 1);
+    u_strToUTF8(VARDATA(out), out_len + 1, &out_len, dest, dest_len, &status);
+    SET_VARSIZE(out, VARHDRSZ + out_len);
+
+    pfree(dest);
+
+    if (U_FAILURE(status))
+    {
+        pfree(out);
+        return NULL;
+    }
+
+    return out;
+}
+
+/*
+Builds the (text_out, converted, dropped_bytes) row of the scalar
+convert_to_UTF8() functions from result, returning value itself if it was
+kept, or a NULL text_out if value is (Datum) 0.  Frees result->text_out.
+*/
+Datum
+convert_result_tuple(FunctionCallInfo fcinfo, Datum value, ConvertResult* result)
+{
+    // things we need to deal with constructing our composite type
+    TupleDesc   tupdesc;
+    Datum       values[3];
+    bool        nulls[3];
+    HeapTuple   tuple;
+
+    // Convert output values into a PostgreSQL composite type.
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record.\n")));
+
+    // BlessTupleDesc for Datums
+    BlessTupleDesc(tupdesc);
+
+    // return the input itself, without a copy, if it was kept
+    if (NULL != result->text_out)
+    {
+        values[0] = PointerGetDatum(result->text_out);
+        nulls[0] = (0 == VARSIZE_ANY_EXHDR(result->text_out));
+    }
+    else
+    {
+        values[0] = value;
+        nulls[0] = ((Datum) 0 == value || VARHDRSZ == toast_raw_datum_size(value));
+    }
+
+    values[1] = BoolGetDatum(result->converted);
+    values[2] = BoolGetDatum(result->dropped_bytes);
+
+    // converted and dropped_bytes will never be NULL
+    nulls[1] = false;
+    nulls[2] = false;
+
+    // build tuple from datum array
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    // the tuple has its own copy; don't hold a large value twice
+    if (NULL != result->text_out)
+        pfree(result->text_out);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+/*
+convert_to_UTF8(text, text): converts text_in from src_encoding, which may
+be a PostgreSQL or an ICU encoding name, without detection.  A single
+forward conversion with callbacks that stop at the first illegal,
+incomplete or unassigned byte stands in for converting back and comparing,
+and no subtransaction is needed to survive a failed conversion.  On
+failure text_in is returned unchanged with converted false.
+*/
+PG_FUNCTION_INFO_V1(convert_to_UTF8_from);
+
+Datum
+convert_to_UTF8_from(PG_FUNCTION_ARGS)
+{
+    TupleDesc   tupdesc;
+    Datum       values[2];
+    bool        nulls[2];
+    HeapTuple   tuple;
+
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    const Datum value   = PG_GETARG_DATUM(0);
+    char        *src_encoding = text_to_cstring(PG_GETARG_TEXT_PP(1));
+    const char  *encoding = icu_encoding_name(src_encoding);
+    int32       len = toast_raw_datum_size(value) - VARHDRSZ;
+
+    text        *text_out = NULL;
+    bool        dropped_bytes = false;
+    UErrorCode  status = U_UNSUPPORTED_ERROR;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record.\n")));
+
+    BlessTupleDesc(tupdesc);
+
+    if (NULL == encoding)
+        ereport(WARNING,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("Cannot convert from %s to UTF8 - ICU has no converter for it.", src_encoding)));
+    else if (stream_threshold > 0 && len > stream_threshold && datum_is_streamable(value))
+        status = transcode_datum_to_utf8(state, value, len, encoding, CONVERT_STRICT, &text_out, &dropped_bytes);
+    else
+    {
+        text *buffer = DatumGetTextPP(value);
+
+        status = transcode_to_utf8(state, VARDATA_ANY(buffer), len, encoding, CONVERT_STRICT, &text_out, &dropped_bytes);
+    }
+
+    if (NULL != encoding && U_FAILURE(status))
+        ereport(WARNING,
+            (errcode(ERRCODE_CHARACTER_NOT_IN_REPERTOIRE),
+             errmsg("Cannot reliably convert text from %s to UTF8 - returning original input.", src_encoding)));
+
+    values[0] = (NULL != text_out) ? PointerGetDatum(text_out) : value;
+    values[1] = BoolGetDatum(U_SUCCESS(status));
+    memset(nulls, 0, sizeof(nulls));
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    if (NULL != text_out)
+        pfree(text_out);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+/*
+repair_mojibake(text): UTF8 that was decoded as windows-1252 or latin1 and
+encoded again is valid UTF8 to ICU, so convert_to_UTF8() keeps it.  The
+double encoded sequences are found and restored natively, one pass per
+layer of double encoding, until a pass finds none.  The input is returned
+as it is if it has none.
+*/
+PG_FUNCTION_INFO_V1(repair_mojibake);
+
+Datum
+repair_mojibake(PG_FUNCTION_ARGS)
+{
+    text        *input = PG_GETARG_TEXT_PP(0);
+    const char  *buffer = VARDATA_ANY(input);
+    size_t      len = VARSIZE_ANY_EXHDR(input);
+    text        *out = NULL;
+    text        *next;
+    size_t      repaired;
+
+    if (!mojibake_find(buffer, len))
+        PG_RETURN_TEXT_P(input);
+
+    for (;;)
+    {
+        // every layer is shorter than the one before
+        next = (text *) palloc(VARHDRSZ + len);
+        len = mojibake_repair(buffer, len, VARDATA(next), &repaired);
+        SET_VARSIZE(next, VARHDRSZ + len);
+
+        if (NULL != out)
+            pfree(out);
+        out = next;
+        buffer = VARDATA(out);
+
+        if (0 == repaired || !mojibake_find(buffer, len))
+            break;
+    }
+
+    PG_RETURN_TEXT_P(out);
+}
+
+/* by reference, variable length */
+
+PG_FUNCTION_INFO_V1(char_set_detect);
+
+Datum
+char_set_detect(PG_FUNCTION_ARGS)
+{
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    // optional second argument overrides pg_chardetect.max_detect_bytes
+    int32       max_bytes = (PG_NARGS() > 1) ? PG_GETARG_INT32(1) : max_detect_bytes;
+
+    return detect_value_tuple(fcinfo, state, PG_GETARG_DATUM(0), max_bytes);
+}
+
+/*
+char_set_detect(text, text[], text): char_set_detect() with the allowed
+charsets and declared encoding given per call instead of by
+pg_chardetect.allowed_charsets and pg_chardetect.declared_encoding.
+*/
+PG_FUNCTION_INFO_V1(char_set_detect_hinted);
+
+Datum
+char_set_detect_hinted(PG_FUNCTION_ARGS)
+{
+    ChardetectState *state = get_chardetect_state(fcinfo);
+    ArrayType   *allowed_array = PG_GETARG_ARRAYTYPE_P(1);
+    Datum       *elems;
+    bool        *elem_nulls;
+    int         nelems;
+    StringInfoData allowed;
+    char        bad[NAMEDATALEN];
+    Datum       result;
+    int         i;
+
+    deconstruct_array(allowed_array, TEXTOID, -1, false, TYPALIGN_INT, &elems, &elem_nulls, &nelems);
+
+    initStringInfo(&allowed);
+    for (i = 0; i < nelems; i++)
+    {
+        if (!elem_nulls[i])
+            appendStringInfo(&allowed, "%s%s", (allowed.len > 0) ? "," : "", TextDatumGetCString(elems[i]));
+    }
+
+    if (!check_charset_list(allowed.data, bad, sizeof(bad)))
+        ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("char_set_detect: \"%s\" is not a charset ICU knows", bad)));
+
+    state->allowed_override = allowed.data;
+    state->declared_override = text_to_cstring(PG_GETARG_TEXT_PP(2));
+
+    // the state outlives this call, so an error must not leave the
+    // overrides behind for the next one
+    PG_TRY();
+    {
+        result = detect_value_tuple(fcinfo, state, PG_GETARG_DATUM(0), max_detect_bytes);
+    }
+    PG_FINALLY();
+    {
+        state->allowed_override = NULL;
+        state->declared_override = NULL;
+    }
+    PG_END_TRY();
+
+    return result;
+}
+
+/*
+Shared by the above: detects value from at most max_bytes bytes and
+returns the char_set_detect row.
+*/
+Datum
+detect_value_tuple(FunctionCallInfo fcinfo, ChardetectState* state, Datum value, int32 max_bytes)
+{
+    // things we need to deal with constructing our composite type
+    TupleDesc   tupdesc;
+    Datum       values[4];
+    bool        nulls[4];
+    HeapTuple   tuple;
+
+    text        *encoding = NULL;
+    text        *lang = NULL;
+    int32_t     confidence = 0;
+    bool        mojibake = false;
+    MemoryContext oldcontext;
+
+    // Convert this value into a PostgreSQL composite type.
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    // BlessTupleDesc for Datums
+    BlessTupleDesc(tupdesc);
+
+    if (max_bytes < 0)
+        ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("max_detect_bytes must not be negative")));
+
+    // the sample and everything detection allocates is dropped with the
+    // scratch context once the tuple holds its own copies
+    oldcontext = MemoryContextSwitchTo(state->scratch);
+    detect_value(state, value, max_bytes, &encoding, &lang, &confidence, &mojibake);
+    MemoryContextSwitchTo(oldcontext);
+
+    values[0] = PointerGetDatum(encoding);
+    values[1] = PointerGetDatum(lang);
+    values[2] = Int32GetDatum(confidence);
+    values[3] = BoolGetDatum(mojibake);
+
+    // check if pointers are still NULL; if so Datum is NULL and
+    // confidence is meaningless (also NULL)
+    (encoding == NULL || ! VARSIZE_ANY_EXHDR(encoding)) ? (nulls[0] = true) : (nulls[0] = false);
+    (lang == NULL || ! VARSIZE_ANY_EXHDR(lang))         ? (nulls[1] = true) : (nulls[1] = false);
+    (nulls[0] == true)                                  ? (nulls[2] = true) : (nulls[2] = false);
+    nulls[3] = false;
+
+    // build tuple from datum array
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    // cleanup
+    MemoryContextReset(state->scratch);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+/*
+char_set_detect_all(text, integer, integer): ICU's ranked candidates from a
+single detection pass, so a caller can pick a fallback when the best match
+is doubtful without detecting again.
+*/
+PG_FUNCTION_INFO_V1(char_set_detect_all);
+
+Datum
+char_set_detect_all(PG_FUNCTION_ARGS)
+{
+    ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+    ChardetectState *state = get_chardetect_state(fcinfo);
+    int32       k = PG_GETARG_INT32(1);
+    int32       min_confidence = PG_GETARG_INT32(2);
+
+    TupleDesc   tupdesc;
+    Tuplestorestate *tupstore;
+    MemoryContext oldcontext;
+
+    UCharsetDetector* csd;
+    const UCharsetMatch** matches = NULL;
+    int32_t     nmatches = 0;
+    const char  *allowed;
+    const char  *declared;
+    const char  *sample;
+    int32       sample_len;
+    UErrorCode  status = U_ZERO_ERROR;
+    int32       nrows = 0;
+    int32_t     i;
+
+    if (NULL == rsinfo || !IsA(rsinfo, ReturnSetInfo) || 0 == (rsinfo->allowedModes & SFRM_Materialize))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("char_set_detect_all: set-valued function called in context that cannot accept a set")));
+
+    if (k < 1)
+        ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("char_set_detect_all: k must be at least 1")));
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    // the rows are read after this call returns
+    oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+    tupdesc = CreateTupleDescCopy(tupdesc);
+    tupstore = tuplestore_begin_heap(true, false, work_mem);
+    MemoryContextSwitchTo(oldcontext);
+
+    rsinfo->returnMode = SFRM_Materialize;
+    rsinfo->setResult = tupstore;
+    rsinfo->setDesc = tupdesc;
+
+    get_detect_sample(PG_GETARG_DATUM(0), max_detect_bytes, &sample, &sample_len);
+
+    // the only candidate char_set_detect(text) would consider
+    if (BYTES_OTHER != classify_bytes(sample, sample_len))
+    {
+        if (min_confidence <= 100)
+            add_candidate_row(tupstore, tupdesc, "UTF-8", NULL, 100, mojibake_find(sample, sample_len));
+
+        return (Datum) 0;
+    }
+
+    detect_options(state, &allowed, &declared);
+
+    csd = get_detector(state, &status);
+
+    if (U_SUCCESS(status))
+    {
+        ucsdet_setText(csd, sample, sample_len, &status);
+        matches = ucsdet_detectAll(csd, &nmatches, &status);
+    }
+
+    for (i = 0; U_SUCCESS(status) && i < nmatches && nrows < k; i++)
+    {
+        const char* name = ucsdet_getName(matches[i], &status);
+        const char* lang = detect_language ? ucsdet_getLanguage(matches[i], &status) : NULL;
+        int32_t confidence = ucsdet_getConfidence(matches[i], &status);
+
+        // matches are sorted by confidence, so no later one qualifies
+        if (confidence < min_confidence)
+            break;
+
+        if ('\0' != *allowed && !charset_in_list(allowed, name))
+            continue;
+
+        add_candidate_row(tupstore, tupdesc, name, lang, confidence,
+                          0 == strcmp(name, "UTF-8") && mojibake_find(sample, sample_len));
+        nrows++;
+    }
+
+    if (U_FAILURE(status))
+        ereport(WARNING,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("ICU error: %s\n", u_errorName(status))));
+
+    return (Datum) 0;
+}
+
+/*
+Adds an (encoding, language, confidence, mojibake) row to the
+char_set_detect_all() result; an empty language is NULL, as in
+char_set_detect().
+*/
+void
+add_candidate_row(Tuplestorestate* tupstore, TupleDesc tupdesc, const char* encoding, const char* lang, int32 confidence, bool mojibake)
+{
+    Datum       values[4];
+    bool        nulls[4];
+
+    memset(nulls, 0, sizeof(nulls));
+
+    values[0] = CStringGetTextDatum(encoding);
+    values[2] = Int32GetDatum(confidence);
+    values[3] = BoolGetDatum(mojibake);
+
+    if (NULL != lang && '\0' != *lang)
+        values[1] = CStringGetTextDatum(lang);
+    else
+        nulls[1] = true;
+
+    tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+}
+
+/*
+Batch variants.  Each call opens the detector and converters once and runs
+every element of the input array through them, so ETL jobs that gather
+values with array_agg pay the per-call overhead once per batch instead of
+once per row.  Each element is processed in a scratch memory context that
+is reset before the next one; only its results are copied out.
+
+Results come back as arrays parallel to the input, with the same
+dimensions.  NULL elements give NULL results.
+*/
+
+PG_FUNCTION_INFO_V1(char_set_detect_array);
+
+Datum
+char_set_detect_array(PG_FUNCTION_ARGS)
+{
+    TupleDesc   tupdesc;
+    Datum       values[3];
+    bool        nulls[3];
+    HeapTuple   tuple;
+
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    ArrayType   *input = PG_GETARG_ARRAYTYPE_P(0);
+    Datum       *elems;
+    bool        *elem_nulls;
+    int         nelems;
+
+    Datum       *encodings;
+    Datum       *langs;
+    Datum       *confidences;
+    bool        *encoding_nulls;
+    bool        *lang_nulls;
+    bool        *confidence_nulls;
+
+    MemoryContext scratch;
+    MemoryContext oldcontext;
+    int         i;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    BlessTupleDesc(tupdesc);
+
+    deconstruct_array(input, TEXTOID, -1, false, TYPALIGN_INT, &elems, &elem_nulls, &nelems);
+
+    encodings = palloc(nelems * sizeof(Datum));
+    langs = palloc(nelems * sizeof(Datum));
+    confidences = palloc(nelems * sizeof(Datum));
+    encoding_nulls = palloc(nelems * sizeof(bool));
+    lang_nulls = palloc(nelems * sizeof(bool));
+    confidence_nulls = palloc(nelems * sizeof(bool));
+
+    scratch = AllocSetContextCreate(CurrentMemoryContext,
+                                    "pg_chardetect element",
+                                    ALLOCSET_DEFAULT_SIZES);
+
+    for (i = 0; i < nelems; i++)
+    {
+        text        *encoding = NULL;
+        text        *lang = NULL;
+        int32_t     confidence = 0;
+
+        encoding_nulls[i] = lang_nulls[i] = confidence_nulls[i] = true;
+
+        if (elem_nulls[i])
+            continue;
+
+        oldcontext = MemoryContextSwitchTo(scratch);
+        detect_value(state, elems[i], max_detect_bytes, &encoding, &lang, &confidence, NULL);
+        MemoryContextSwitchTo(oldcontext);
+
+        // same NULL rules as char_set_detect(text)
+        if (NULL != encoding && VARSIZE_ANY_EXHDR(encoding))
+        {
+            encodings[i] = PointerGetDatum(copy_text(encoding));
+            confidences[i] = Int32GetDatum(confidence);
+            encoding_nulls[i] = confidence_nulls[i] = false;
+        }
+
+        if (NULL != lang && VARSIZE_ANY_EXHDR(lang))
+        {
+            langs[i] = PointerGetDatum(copy_text(lang));
+            lang_nulls[i] = false;
+        }
+
+        MemoryContextReset(scratch);
+    }
+
+    MemoryContextDelete(scratch);
+
+    values[0] = PointerGetDatum(construct_result_array(input, encodings, encoding_nulls, TEXTOID));
+    values[1] = PointerGetDatum(construct_result_array(input, langs, lang_nulls, TEXTOID));
+    values[2] = PointerGetDatum(construct_result_array(input, confidences, confidence_nulls, INT4OID));
+    nulls[0] = nulls[1] = nulls[2] = false;
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+PG_FUNCTION_INFO_V1(convert_to_UTF8_array);
+
+Datum
+convert_to_UTF8_array(PG_FUNCTION_ARGS)
+{
+    TupleDesc   tupdesc;
+    Datum       values[3];
+    bool        nulls[3];
+    HeapTuple   tuple;
+
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    ArrayType   *input = PG_GETARG_ARRAYTYPE_P(0);
+    const bool  force = PG_GETARG_BOOL(1);
+    // the three argument form pools the elements of one value
+    const bool  pool = (PG_NARGS() > 2) && PG_GETARG_BOOL(2);
+    Datum       *elems;
+    bool        *elem_nulls;
+    int         nelems;
+
+    Datum       *texts_out;
+    Datum       *converted;
+    Datum       *dropped_bytes;
+    bool        *text_nulls;
+    bool        *flag_nulls;
+    ConvertResult *pooled_results = NULL;
+    bool        changed = false;
+
+    MemoryContext scratch;
+    MemoryContext oldcontext;
+    int         i;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record.\n")));
+
+    BlessTupleDesc(tupdesc);
+
+    deconstruct_array(input, TEXTOID, -1, false, TYPALIGN_INT, &elems, &elem_nulls, &nelems);
+
+    texts_out = palloc(nelems * sizeof(Datum));
+    converted = palloc(nelems * sizeof(Datum));
+    dropped_bytes = palloc(nelems * sizeof(Datum));
+    text_nulls = palloc(nelems * sizeof(bool));
+    flag_nulls = palloc(nelems * sizeof(bool));
+
+    scratch = AllocSetContextCreate(CurrentMemoryContext,
+                                    "pg_chardetect element",
+                                    ALLOCSET_DEFAULT_SIZES);
+
+    if (pool)
+    {
+        const char  **leaves = palloc(Max(nelems, 1) * sizeof(char*));
+        int32       *lens = palloc(Max(nelems, 1) * sizeof(int32));
+
+        for (i = 0; i < nelems; i++)
+        {
+            leaves[i] = elem_nulls[i] ? NULL : VARDATA_ANY(DatumGetPointer(elems[i]));
+            lens[i] = elem_nulls[i] ? 0 : VARSIZE_ANY_EXHDR(DatumGetPointer(elems[i]));
+        }
+
+        pooled_results = palloc(Max(nelems, 1) * sizeof(ConvertResult));
+        convert_leaves(state, nelems, leaves, lens, force, pooled_results);
+    }
+
+    for (i = 0; i < nelems; i++)
+    {
+        ConvertResult result;
+
+        text_nulls[i] = flag_nulls[i] = true;
+
+        if (elem_nulls[i])
+            continue;
+
+        if (pool)
+            result = pooled_results[i];
+        else
+        {
+            oldcontext = MemoryContextSwitchTo(scratch);
+            convert_datum(state, elems[i], force, &result);
+            MemoryContextSwitchTo(oldcontext);
+        }
+
+        // the array is built from copies, so the input element itself
+        // can stand in for an unconverted value
+        if (NULL != result.text_out)
+        {
+            text_nulls[i] = (0 == VARSIZE_ANY_EXHDR(result.text_out));
+            texts_out[i] = PointerGetDatum(copy_text(result.text_out));
+        }
+        else
+        {
+            text_nulls[i] = (0 == VARSIZE_ANY_EXHDR(DatumGetPointer(elems[i])));
+            texts_out[i] = elems[i];
+        }
+
+        changed = changed || NULL != result.text_out || text_nulls[i];
+
+        converted[i] = BoolGetDatum(result.converted);
+        dropped_bytes[i] = BoolGetDatum(result.dropped_bytes);
+        flag_nulls[i] = false;
+
+        MemoryContextReset(scratch);
+    }
+
+    MemoryContextDelete(scratch);
+
+    // no element changed: the input array is the result
+    values[0] = changed ? PointerGetDatum(construct_result_array(input, texts_out, text_nulls, TEXTOID))
+                        : PointerGetDatum(input);
+    values[1] = PointerGetDatum(construct_result_array(input, converted, flag_nulls, BOOLOID));
+    values[2] = PointerGetDatum(construct_result_array(input, dropped_bytes, flag_nulls, BOOLOID));
+    nulls[0] = nulls[1] = nulls[2] = false;
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+/*
+convert_to_UTF8(jsonb, boolean): converts the keys and strings of a jsonb
+document, with the short ones pooled for detection by convert_leaves().
+The document is walked once to collect its strings, and rebuilt only if
+one of them changed.
+*/
+PG_FUNCTION_INFO_V1(convert_jsonb_to_UTF8);
+
+Datum
+convert_jsonb_to_UTF8(PG_FUNCTION_ARGS)
+{
+    TupleDesc   tupdesc;
+    Datum       values[3];
+    bool        nulls[3];
+    HeapTuple   tuple;
+
+    ChardetectState *state = get_chardetect_state(fcinfo);
+
+    Jsonb       *jb = PG_GETARG_JSONB_P(0);
+    const bool  force = PG_GETARG_BOOL(1);
+
+    JsonbIterator *it;
+    JsonbValue  v;
+    JsonbIteratorToken r;
+
+    const char  **leaves;
+    int32       *lens;
+    ConvertResult *results;
+    int         nleaves = 0;
+    int         maxleaves = 16;
+    bool        converted = true;
+    bool        dropped_bytes = false;
+    bool        changed = false;
+    int         i;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record.\n")));
+
+    BlessTupleDesc(tupdesc);
+
+    leaves = palloc(maxleaves * sizeof(char*));
+    lens = palloc(maxleaves * sizeof(int32));
+
+    // the strings point into jb, in document order
+    it = JsonbIteratorInit(&jb->root);
+
+    while (WJB_DONE != (r = JsonbIteratorNext(&it, &v, false)))
+    {
+        if ((WJB_KEY != r && WJB_VALUE != r && WJB_ELEM != r) || jbvString != v.type)
+            continue;
+
+        if (nleaves == maxleaves)
+        {
+            maxleaves *= 2;
+            leaves = repalloc(leaves, maxleaves * sizeof(char*));
+            lens = repalloc(lens, maxleaves * sizeof(int32));
+        }
+
+        leaves[nleaves] = v.val.string.val;
+        lens[nleaves] = v.val.string.len;
+        nleaves++;
+    }
+
+    results = palloc(Max(nleaves, 1) * sizeof(ConvertResult));
+    convert_leaves(state, nleaves, leaves, lens, force, results);
+
+    for (i = 0; i < nleaves; i++)
+    {
+        converted = converted && results[i].converted;
+        dropped_bytes = dropped_bytes || results[i].dropped_bytes;
+        changed = changed || NULL != results[i].text_out;
+    }
+
+    values[0] = changed ? JsonbPGetDatum(replace_jsonb_strings(jb, results)) : JsonbPGetDatum(jb);
+    values[1] = BoolGetDatum(converted);
+    values[2] = BoolGetDatum(dropped_bytes);
+    memset(nulls, 0, sizeof(nulls));
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+/*
+Rebuilds jb with its strings replaced, in document order, by the converted
+results convert_jsonb_to_UTF8() got for them.
+*/
+Jsonb*
+replace_jsonb_strings(Jsonb* jb, const ConvertResult* results)
+{
+    JsonbParseState *parse = NULL;
+    JsonbValue  *res = NULL;
+    JsonbIterator *it = JsonbIteratorInit(&jb->root);
+    JsonbValue  v;
+    JsonbIteratorToken r;
+    int         leaf = 0;
+
+    while (WJB_DONE != (r = JsonbIteratorNext(&it, &v, false)))
+    {
+        if ((WJB_KEY == r || WJB_VALUE == r || WJB_ELEM == r) && jbvString == v.type)
+        {
+            const text *out = results[leaf++].text_out;
+
+            if (NULL != out)
+            {
+                v.val.string.val = VARDATA_ANY(out);
+                v.val.string.len = VARSIZE_ANY_EXHDR(out);
+            }
+        }
+
+        // scalars go in with their value, and so does the array holding a
+        // top level scalar, to keep it a scalar
+        res = pushJsonbValue(&parse, r,
+                             (r < WJB_BEGIN_ARRAY || (WJB_BEGIN_ARRAY == r && v.val.array.rawScalar)) ? &v : NULL);
+    }
+
+    return JsonbValueToJsonb(res);
+}
+
+/*
+Detects the charset of a text or bytea datum from at most max_bytes of it
+(0 for all of it), fetching only those bytes of a TOASTed value.
+*/
+void
+detect_value(ChardetectState* state, Datum value, int32 max_bytes, text** encoding, text** lang, int32_t* confidence, bool* mojibake)
+{
+    const char  *sample;
+    int32       sample_len;
+    UErrorCode  status;
+
+    // fetch only as much of the value as detection will look at
+    get_detect_sample(value, max_bytes, &sample, &sample_len);
+
+    status = detect_charset(state, sample, sample_len, encoding, lang, confidence);
+
+    // double encoding only shows in text that is valid UTF-8
+    if (NULL != mojibake)
+        *mojibake = NULL != *encoding && encoding_is_utf8(*encoding)
+                    && mojibake_find(sample, sample_len);
+
+    if (message_level_is_interesting(DEBUG1))
+    {
+        ereport(DEBUG1,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("ICU detection status: %d\n", status)));
+
+        if (NULL != *encoding)
+            ereport(DEBUG1,
+                (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+                 errmsg("Detected encoding: %s, length: %d\n", text_to_cstring(*encoding), VARSIZE_ANY_EXHDR(*encoding))));
+    }
+}
+
+/*
+True if encoding, a detection result, names UTF-8.
+*/
+bool
+encoding_is_utf8(const text* encoding)
+{
+    return 5 == VARSIZE_ANY_EXHDR(encoding) && 0 == memcmp(VARDATA_ANY(encoding), "UTF-8", 5);
+}
+
+/*
+Copies a text value into CurrentMemoryContext.
+*/
+text*
+copy_text(const text* t)
+{
+    text* copy = (text *) palloc(VARSIZE_ANY(t));
+
+    memcpy(copy, t, VARSIZE_ANY(t));
+    return copy;
+}
+
+/*
+Builds an array of element_type with the dimensions of input.
+*/
+ArrayType*
+construct_result_array(ArrayType* input, Datum* elems, bool* nulls, Oid element_type)
+{
+    int16       typlen;
+    bool        typbyval;
+    char        typalign;
+    int         ndims = ARR_NDIM(input);
+
+    get_typlenbyvalalign(element_type, &typlen, &typbyval, &typalign);
+
+    if (0 == ndims)
+        return construct_empty_array(element_type);
+
+    return construct_md_array(elems, nulls, ndims, ARR_DIMS(input), ARR_LBOUND(input),
+                              element_type, typlen, typbyval, typalign);
+}
+
+
+
+/*
+charset_profile(text) aggregate.
+
+The transition state is a short list of encodings seen so far with their
+counts and sums, kept in the aggregate's memory context.  Detection costs
+far more than anything done with the state, so a linear search over the
+few dozen encodings ICU knows is all the lookup needed.  The state can be
+serialized and combined, so the aggregate runs in parallel workers.
+*/
+
+ProfileState*
+profile_state_create(MemoryContext aggcontext)
+{
+    ProfileState* pstate = MemoryContextAlloc(aggcontext, sizeof(ProfileState));
+
+    pstate->nentries = 0;
+    pstate->maxentries = 8;
+    pstate->entries = MemoryContextAlloc(aggcontext, pstate->maxentries * sizeof(ProfileEntry));
+
+    return pstate;
+}
+
+/*
+Returns the entry for encoding, NULL for failed detection, adding it if
+it is not there yet.  The entries array lives in the same context as the
+state.
+*/
+ProfileEntry*
+profile_state_entry(ProfileState* pstate, const char* encoding)
+{
+    ProfileEntry* entry;
+    int i;
+
+    for (i = 0; i < pstate->nentries; i++)
+    {
+        entry = &pstate->entries[i];
+
+        if (NULL == encoding ? entry->isnull : (!entry->isnull && 0 == strcmp(entry->encoding, encoding)))
+            return entry;
+    }
+
+    if (pstate->nentries == pstate->maxentries)
+    {
+        pstate->maxentries *= 2;
+        pstate->entries = repalloc(pstate->entries, pstate->maxentries * sizeof(ProfileEntry));
+    }
+
+    entry = &pstate->entries[pstate->nentries++];
+    memset(entry, 0, sizeof(ProfileEntry));
+
+    if (NULL == encoding)
+        entry->isnull = true;
+    else
+        strlcpy(entry->encoding, encoding, NAMEDATALEN);
+
+    return entry;
+}
+
+PG_FUNCTION_INFO_V1(charset_profile_transfn);
+
+Datum
+charset_profile_transfn(PG_FUNCTION_ARGS)
+{
+    MemoryContext   aggcontext;
+    ProfileState    *pstate;
+    ProfileEntry    *entry;
+    ChardetectState *state;
+
+    Datum           value;
+    const char      *sample;
+    int32           sample_len;
+    ByteClass       byte_class;
+    text            *encoding = NULL;
+    text            *lang = NULL;
+    int32_t         confidence = 0;
+    char            *encoding_cstr = NULL;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("charset_profile_transfn called in non-aggregate context")));
+
+    pstate = PG_ARGISNULL(0) ? profile_state_create(aggcontext) : (ProfileState *) PG_GETARG_POINTER(0);
+
+    if (PG_ARGISNULL(1))
+        PG_RETURN_POINTER(pstate);
+
+    state = get_chardetect_state(fcinfo);
+    value = PG_GETARG_DATUM(1);
+
+    get_detect_sample(value, max_detect_bytes, &sample, &sample_len);
+    byte_class = classify_bytes(sample, sample_len);
+
+    if (BYTES_OTHER == byte_class)
+    {
+        detect_charset(state, sample, sample_len, &encoding, &lang, &confidence);
+
+        if (NULL != encoding && VARSIZE_ANY_EXHDR(encoding))
+            encoding_cstr = text_to_cstring(encoding);
+    }
+    else
+    {
+        encoding_cstr = "UTF-8";
+        confidence = 100;
+    }
+
+    entry = profile_state_entry(pstate, encoding_cstr);
+    entry->count++;
+    entry->ascii_count += (BYTES_ASCII == byte_class);
+    entry->confidence_sum += confidence;
+    entry->bytes += toast_raw_datum_size(value) - VARHDRSZ;
+
+    PG_RETURN_POINTER(pstate);
+}
+
+PG_FUNCTION_INFO_V1(charset_profile_combinefn);
+
+Datum
+charset_profile_combinefn(PG_FUNCTION_ARGS)
+{
+    MemoryContext   aggcontext;
+    ProfileState    *pstate1;
+    ProfileState    *pstate2;
+    int             i;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("charset_profile_combinefn called in non-aggregate context")));
+
+    if (PG_ARGISNULL(1))
+    {
+        if (PG_ARGISNULL(0))
+            PG_RETURN_NULL();
+
+        PG_RETURN_POINTER(PG_GETARG_POINTER(0));
+    }
+
+    pstate1 = PG_ARGISNULL(0) ? profile_state_create(aggcontext) : (ProfileState *) PG_GETARG_POINTER(0);
+    pstate2 = (ProfileState *) PG_GETARG_POINTER(1);
+
+    for (i = 0; i < pstate2->nentries; i++)
+    {
+        ProfileEntry* from = &pstate2->entries[i];
+        ProfileEntry* to = profile_state_entry(pstate1, from->isnull ? NULL : from->encoding);
+
+        to->count += from->count;
+        to->ascii_count += from->ascii_count;
+        to->confidence_sum += from->confidence_sum;
+        to->bytes += from->bytes;
+    }
+
+    PG_RETURN_POINTER(pstate1);
+}
+
+PG_FUNCTION_INFO_V1(charset_profile_serialfn);
+
+Datum
+charset_profile_serialfn(PG_FUNCTION_ARGS)
+{
+    ProfileState    *pstate = (ProfileState *) PG_GETARG_POINTER(0);
+    StringInfoData  buf;
+    int             i;
+
+    pq_begintypsend(&buf);
+    pq_sendint32(&buf, pstate->nentries);
+
+    for (i = 0; i < pstate->nentries; i++)
+    {
+        ProfileEntry* entry = &pstate->entries[i];
+
+        pq_sendbyte(&buf, entry->isnull);
+        pq_sendstring(&buf, entry->encoding);
+        pq_sendint64(&buf, entry->count);
+        pq_sendint64(&buf, entry->ascii_count);
+        pq_sendint64(&buf, entry->confidence_sum);
+        pq_sendint64(&buf, entry->bytes);
+    }
+
+    PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(charset_profile_deserialfn);
+
+Datum
+charset_profile_deserialfn(PG_FUNCTION_ARGS)
+{
+    bytea           *serialized = PG_GETARG_BYTEA_PP(0);
+    MemoryContext   aggcontext;
+    ProfileState    *pstate;
+    StringInfoData  buf;
+    int             nentries;
+    int             i;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("charset_profile_deserialfn called in non-aggregate context")));
+
+    initStringInfo(&buf);
+    appendBinaryStringInfo(&buf, VARDATA_ANY(serialized), VARSIZE_ANY_EXHDR(serialized));
+
+    pstate = profile_state_create(aggcontext);
+    nentries = pq_getmsgint(&buf, 4);
+
+    for (i = 0; i < nentries; i++)
+    {
+        bool        isnull = pq_getmsgbyte(&buf);
+        const char  *encoding = pq_getmsgstring(&buf);
+        ProfileEntry* entry = profile_state_entry(pstate, isnull ? NULL : encoding);
+
+        entry->count = pq_getmsgint64(&buf);
+        entry->ascii_count = pq_getmsgint64(&buf);
+        entry->confidence_sum = pq_getmsgint64(&buf);
+        entry->bytes = pq_getmsgint64(&buf);
+    }
+
+    pq_getmsgend(&buf);
+    pfree(buf.data);
+
+    PG_RETURN_POINTER(pstate);
+}
+
+// most frequent encoding first
+int
+profile_entry_cmp(const void* a, const void* b)
+{
+    const ProfileEntry* ea = (const ProfileEntry*) a;
+    const ProfileEntry* eb = (const ProfileEntry*) b;
+
+    if (ea->count != eb->count)
+        return (ea->count > eb->count) ? -1 : 1;
+
+    return strcmp(ea->encoding, eb->encoding);
+}
+
+PG_FUNCTION_INFO_V1(charset_profile_finalfn);
+
+Datum
+charset_profile_finalfn(PG_FUNCTION_ARGS)
+{
+    ProfileState    *pstate;
+    ProfileEntry    *sorted;
+    Oid             element_type;
+    TupleDesc       tupdesc;
+    Datum           *rows;
+    int16           typlen;
+    bool            typbyval;
+    char            typalign;
+    int             i;
+
+    if (PG_ARGISNULL(0))
+        PG_RETURN_NULL();
+
+    pstate = (ProfileState *) PG_GETARG_POINTER(0);
+
+    // the final function must not change the state, which window
+    // aggregates pass to it again, so sort a copy
+    sorted = palloc(pstate->nentries * sizeof(ProfileEntry));
+    memcpy(sorted, pstate->entries, pstate->nentries * sizeof(ProfileEntry));
+    qsort(sorted, pstate->nentries, sizeof(ProfileEntry), profile_entry_cmp);
+
+    rows = palloc(pstate->nentries * sizeof(Datum));
+    element_type = get_element_type(get_fn_expr_rettype(fcinfo->flinfo));
+    tupdesc = lookup_rowtype_tupdesc(element_type, -1);
+
+    for (i = 0; i < pstate->nentries; i++)
+    {
+        ProfileEntry* entry = &sorted[i];
+        Datum       values[5];
+        bool        nulls[5];
+
+        values[0] = entry->isnull ? (Datum) 0 : PointerGetDatum(cstring_to_text(entry->encoding));
+        values[1] = Int64GetDatum(entry->count);
+        values[2] = Int64GetDatum(entry->ascii_count);
+        values[3] = Float8GetDatum((double) entry->confidence_sum / entry->count);
+        values[4] = Int64GetDatum(entry->bytes);
+
+        memset(nulls, 0, sizeof(nulls));
+        nulls[0] = entry->isnull;
+
+        rows[i] = HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls));
+    }
+
+    ReleaseTupleDesc(tupdesc);
+
+    get_typlenbyvalalign(element_type, &typlen, &typbyval, &typalign);
+
+    PG_RETURN_ARRAYTYPE_P(construct_array(rows, pstate->nentries, element_type, typlen, typbyval, typalign));
+}
+
+
+
+/*
+char_set_detect_agg(text [, max_bytes]) aggregate.
+
+Short values give the detector too little to go on.  Instead of detecting
+each row, the aggregate pools the non-ASCII values of a column or group,
+newline separated, into one buffer of at most max_bytes and detects the
+pooled bytes once.  ASCII values carry no charset information and are only
+counted.  Once the pool is full further values are counted but not read.
+*/
+
+DetectAggState*
+detect_agg_state_create(MemoryContext aggcontext, int32 max_bytes)
+{
+    MemoryContext oldcontext = MemoryContextSwitchTo(aggcontext);
+    DetectAggState* astate = palloc(sizeof(DetectAggState));
+
+    initStringInfo(&astate->pool);
+    astate->max_bytes = max_bytes;
+    astate->rows = 0;
+
+    MemoryContextSwitchTo(oldcontext);
+
+    return astate;
+}
+
+/*
+Appends as much of len bytes of data to the pool as fits, never splitting
+a UTF8 sequence.
+*/
+void
+detect_agg_append(DetectAggState* astate, const char* data, int32 len)
+{
+    int32 room = astate->max_bytes - astate->pool.len;
+
+    if (astate->pool.len > 0)
+    {
+        if (room <= 1)
+            return;
+
+        appendStringInfoChar(&astate->pool, '\n');
+        room--;
+    }
+
+    if (len > room)
+        len = room - utf8_partial_tail(data, room);
+
+    appendBinaryStringInfo(&astate->pool, data, len);
+}
+
+PG_FUNCTION_INFO_V1(char_set_detect_agg_transfn);
+
+Datum
+char_set_detect_agg_transfn(PG_FUNCTION_ARGS)
+{
+    MemoryContext   aggcontext;
+    DetectAggState  *astate;
+    const char      *sample;
+    int32           sample_len;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("char_set_detect_agg_transfn called in non-aggregate context")));
+
+    if (PG_ARGISNULL(0))
+    {
+        int32 max_bytes = max_detect_bytes;
+
+        if (PG_NARGS() > 2 && !PG_ARGISNULL(2))
+            max_bytes = PG_GETARG_INT32(2);
+
+        if (max_bytes < 0)
+            ereport(ERROR,
+                (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+                 errmsg("max_bytes must not be negative")));
+
+        astate = detect_agg_state_create(aggcontext, (max_bytes > 0) ? max_bytes : DEFAULT_DETECT_AGG_BYTES);
+    }
+    else
+        astate = (DetectAggState *) PG_GETARG_POINTER(0);
+
+    if (PG_ARGISNULL(1))
+        PG_RETURN_POINTER(astate);
+
+    astate->rows++;
+
+    // the pool is full
+    if (astate->pool.len >= astate->max_bytes - 1)
+        PG_RETURN_POINTER(astate);
+
+    // fetch no more of the value than can still be pooled
+    get_detect_sample(PG_GETARG_DATUM(1), astate->max_bytes - astate->pool.len, &sample, &sample_len);
+
+    if (ascii_prefix_len(sample, sample_len) < (size_t) sample_len)
+        detect_agg_append(astate, sample, sample_len);
+
+    PG_RETURN_POINTER(astate);
+}
+
+PG_FUNCTION_INFO_V1(char_set_detect_agg_combinefn);
+
+Datum
+char_set_detect_agg_combinefn(PG_FUNCTION_ARGS)
+{
+    MemoryContext   aggcontext;
+    DetectAggState  *astate1;
+    DetectAggState  *astate2;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("char_set_detect_agg_combinefn called in non-aggregate context")));
+
+    if (PG_ARGISNULL(1))
+    {
+        if (PG_ARGISNULL(0))
+            PG_RETURN_NULL();
+
+        PG_RETURN_POINTER(PG_GETARG_POINTER(0));
+    }
+
+    astate2 = (DetectAggState *) PG_GETARG_POINTER(1);
+
+    astate1 = PG_ARGISNULL(0) ? detect_agg_state_create(aggcontext, astate2->max_bytes)
+                              : (DetectAggState *) PG_GETARG_POINTER(0);
+
+    astate1->rows += astate2->rows;
+
+    if (astate2->pool.len > 0)
+        detect_agg_append(astate1, astate2->pool.data, astate2->pool.len);
+
+    PG_RETURN_POINTER(astate1);
+}
+
+PG_FUNCTION_INFO_V1(char_set_detect_agg_serialfn);
+
+Datum
+char_set_detect_agg_serialfn(PG_FUNCTION_ARGS)
+{
+    DetectAggState  *astate = (DetectAggState *) PG_GETARG_POINTER(0);
+    StringInfoData  buf;
+
+    pq_begintypsend(&buf);
+    pq_sendint32(&buf, astate->max_bytes);
+    pq_sendint64(&buf, astate->rows);
+    pq_sendint32(&buf, astate->pool.len);
+    pq_sendbytes(&buf, astate->pool.data, astate->pool.len);
+
+    PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(char_set_detect_agg_deserialfn);
+
+Datum
+char_set_detect_agg_deserialfn(PG_FUNCTION_ARGS)
+{
+    bytea           *serialized = PG_GETARG_BYTEA_PP(0);
+    MemoryContext   aggcontext;
+    DetectAggState  *astate;
+    StringInfoData  buf;
+    int32           len;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("char_set_detect_agg_deserialfn called in non-aggregate context")));
+
+    // read straight from the bytea, without a copy
+    buf.data = VARDATA_ANY(serialized);
+    buf.len = VARSIZE_ANY_EXHDR(serialized);
+    buf.maxlen = buf.len;
+    buf.cursor = 0;
+
+    astate = detect_agg_state_create(aggcontext, pq_getmsgint(&buf, 4));
+    astate->rows = pq_getmsgint64(&buf);
+    len = pq_getmsgint(&buf, 4);
+    appendBinaryStringInfo(&astate->pool, pq_getmsgbytes(&buf, len), len);
+    pq_getmsgend(&buf);
+
+    PG_RETURN_POINTER(astate);
+}
+
+PG_FUNCTION_INFO_V1(char_set_detect_agg_finalfn);
+
+Datum
+char_set_detect_agg_finalfn(PG_FUNCTION_ARGS)
+{
+    TupleDesc       tupdesc;
+    Datum           values[4];
+    bool            nulls[4];
+    HeapTuple       tuple;
+
+    DetectAggState  *astate;
+    text            *encoding = NULL;
+    text            *lang = NULL;
+    int32_t         confidence = 0;
+
+    if (PG_ARGISNULL(0))
+        PG_RETURN_NULL();
+
+    astate = (DetectAggState *) PG_GETARG_POINTER(0);
+
+    // only NULLs
+    if (0 == astate->rows)
+        PG_RETURN_NULL();
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    BlessTupleDesc(tupdesc);
+
+    // all ASCII
+    if (0 == astate->pool.len)
+    {
+        encoding = cstring_to_text("UTF-8");
+        confidence = 100;
+    }
+    else
+        detect_charset(get_chardetect_state(fcinfo), astate->pool.data, astate->pool.len, &encoding, &lang, &confidence);
+
+    values[0] = PointerGetDatum(encoding);
+    values[1] = PointerGetDatum(lang);
+    values[2] = Int32GetDatum(confidence);
+
+    values[3] = BoolGetDatum(NULL != encoding && encoding_is_utf8(encoding)
+                             && mojibake_find(astate->pool.data, astate->pool.len));
+
+    // same NULL rules as char_set_detect(text)
+    nulls[0] = (encoding == NULL || ! VARSIZE_ANY_EXHDR(encoding));
+    nulls[1] = (lang == NULL || ! VARSIZE_ANY_EXHDR(lang));
+    nulls[2] = nulls[0];
+    nulls[3] = false;
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
+
+
+
+/*
+pg_chardetect_convert_trigger() row trigger.
+
+A BEFORE INSERT OR UPDATE ... FOR EACH ROW trigger that force converts the
+text and varchar columns named in its arguments, or all of them if it has
+none, to UTF8 in place.  Values that are ASCII or valid UTF8 are left as
+they are, and on UPDATE so are columns whose new value is the old one, so
+only columns that need it pay for detection.  All converted columns are
+replaced with one heap_modify_tuple_by_cols() call.
+
+    CREATE TRIGGER convert_on_write BEFORE INSERT OR UPDATE ON test
+        FOR EACH ROW EXECUTE PROCEDURE pg_chardetect_convert_trigger(convert_this);
+*/
+
+PG_FUNCTION_INFO_V1(pg_chardetect_convert_trigger);
+
+Datum
+pg_chardetect_convert_trigger(PG_FUNCTION_ARGS)
+{
+    TriggerData     *trigdata = (TriggerData *) fcinfo->context;
+    ChardetectState *state;
+    TupleDesc       tupdesc;
+    HeapTuple       newtuple;
+    HeapTuple       oldtuple = NULL;
+
+    int             *columns;
+    Datum           *values;
+    bool            *nulls;
+    int             nreplaced = 0;
+    int             i;
+
+    if (!CALLED_AS_TRIGGER(fcinfo))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_trigger: not called by trigger manager")));
+
+    if (!TRIGGER_FIRED_BEFORE(trigdata->tg_event) || !TRIGGER_FIRED_FOR_ROW(trigdata->tg_event))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_trigger: must be fired before event, for each row")));
+
+    if (TRIGGER_FIRED_BY_INSERT(trigdata->tg_event))
+        newtuple = trigdata->tg_trigtuple;
+    else if (TRIGGER_FIRED_BY_UPDATE(trigdata->tg_event))
+    {
+        oldtuple = trigdata->tg_trigtuple;
+        newtuple = trigdata->tg_newtuple;
+    }
     else
     {
-        // extract string from text* to C string
-        cbuffer = text_to_cstring(buffer);
-        cbuffer_len = strlen(cbuffer);
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_trigger: must be fired for INSERT or UPDATE")));
+        return (Datum) 0;   // keep compiler quiet
+    }
+
+    state = get_chardetect_state(fcinfo);
+    tupdesc = trigdata->tg_relation->rd_att;
+
+    if (state->trigger_oid != trigdata->tg_trigger->tgoid)
+        resolve_trigger_columns(state, fcinfo->flinfo->fn_mcxt, trigdata->tg_trigger, trigdata->tg_relation);
+
+    columns = palloc(state->trigger_ncolumns * sizeof(int));
+    values = palloc(state->trigger_ncolumns * sizeof(Datum));
+    nulls = palloc(state->trigger_ncolumns * sizeof(bool));
+
+    for (i = 0; i < state->trigger_ncolumns; i++)
+    {
+        int             attnum = state->trigger_columns[i];
+        Form_pg_attribute attr = TupleDescAttr(tupdesc, attnum - 1);
+        bool            isnull;
+        Datum           value = heap_getattr(newtuple, attnum, tupdesc, &isnull);
+        ColumnDecision  decision;
+        ConvertResult   result;
+
+        if (isnull)
+            continue;
+
+        // unchanged by the UPDATE: converted, or left alone, when written
+        if (NULL != oldtuple)
+        {
+            bool    old_isnull;
+            Datum   old_value = heap_getattr(oldtuple, attnum, tupdesc, &old_isnull);
+
+            if (!old_isnull && datum_image_eq(value, old_value, attr->attbyval, attr->attlen))
+                continue;
+        }
+
+        column_decision_lookup(RelationGetRelid(trigdata->tg_relation), attnum, &decision);
+        convert_column(state, value, &decision, true, &result);
+
+        if (NULL == result.text_out)
+            continue;
+
+        columns[nreplaced] = attnum;
+        values[nreplaced] = PointerGetDatum(result.text_out);
+        nulls[nreplaced] = false;
+        nreplaced++;
+    }
+
+    if (nreplaced > 0)
+        newtuple = heap_modify_tuple_by_cols(newtuple, tupdesc, nreplaced, columns, values, nulls);
+
+    return PointerGetDatum(newtuple);
+}
+
+/*
+Resolves the column names in the trigger's arguments to attribute numbers,
+or picks every text and varchar column if there are none, and keeps them
+in state for the rest of the query.
+*/
+void
+resolve_trigger_columns(ChardetectState* state, MemoryContext context, Trigger* trigger, Relation relation)
+{
+    int *columns;
+
+    columns = MemoryContextAlloc(context, Max(trigger->tgnargs, relation->rd_att->natts) * sizeof(int));
+
+    if (NULL != state->trigger_columns)
+        pfree(state->trigger_columns);
+
+    state->trigger_ncolumns = resolve_columns("pg_chardetect_convert_trigger", relation,
+                                              (const char**) trigger->tgargs, trigger->tgnargs, columns);
+    state->trigger_columns = columns;
+    state->trigger_oid = trigger->tgoid;
+}
+
+/*
+Resolves nnames column names of relation to attribute numbers in columns,
+or picks every text and varchar column if nnames is 0, and returns how
+many there are.  columns must have room for nnames, or for every column of
+relation.  caller names the function in error messages.
+*/
+int
+resolve_columns(const char* caller, Relation relation, const char** names, int nnames, int* columns)
+{
+    TupleDesc   tupdesc = relation->rd_att;
+    int         ncolumns = 0;
+    int         i;
+    int         j;
+
+    if (0 == nnames)
+    {
+        for (i = 0; i < tupdesc->natts; i++)
+        {
+            Form_pg_attribute attr = TupleDescAttr(tupdesc, i);
+
+            if (!attr->attisdropped && is_text_type(attr->atttypid))
+                columns[ncolumns++] = attr->attnum;
+        }
+    }
+
+    for (j = 0; j < nnames; j++)
+    {
+        const char* name = names[j];
+        Form_pg_attribute attr = NULL;
+
+        for (i = 0; i < tupdesc->natts; i++)
+        {
+            attr = TupleDescAttr(tupdesc, i);
+
+            if (!attr->attisdropped && 0 == strcmp(NameStr(attr->attname), name))
+                break;
+        }
+
+        if (i == tupdesc->natts)
+            ereport(ERROR,
+                (errcode(ERRCODE_UNDEFINED_COLUMN),
+                 errmsg("%s: column \"%s\" of relation \"%s\" does not exist",
+                        caller, name, RelationGetRelationName(relation))));
+
+        if (!is_text_type(attr->atttypid))
+            ereport(ERROR,
+                (errcode(ERRCODE_DATATYPE_MISMATCH),
+                 errmsg("%s: column \"%s\" of relation \"%s\" is not of type text or varchar",
+                        caller, name, RelationGetRelationName(relation))));
+
+        columns[ncolumns++] = attr->attnum;
+    }
+
+    return ncolumns;
+}
+
+/*
+True for text, varchar, and domains over them.
+*/
+bool
+is_text_type(Oid type)
+{
+    type = getBaseType(type);
+
+    return TEXTOID == type || VARCHAROID == type;
+}
+
+/*
+convert_record_to_utf8(anyelement, boolean).
+
+Converts every text and varchar column of a row with one call, instead of
+one convert_to_UTF8() call and result tuple per column, e.g. for a wide
+table:
+
+    SELECT (c).row_out, (c).changed_columns
+        FROM (SELECT convert_record_to_utf8(t, true) AS c FROM test t) s;
+
+The text columns of the row type are found once per call site and kept in
+the state with its detector and converters.  Columns of a table row follow
+its pg_chardetect_column_encoding decisions.  The row comes back with one
+heap_modify_tuple_by_cols() call, or unchanged if no column needed
+converting.
+*/
+
+PG_FUNCTION_INFO_V1(convert_record_to_utf8);
+
+Datum
+convert_record_to_utf8(PG_FUNCTION_ARGS)
+{
+    TupleDesc       tupdesc;
+    Datum           result_values[2];
+    bool            result_nulls[2];
+    HeapTuple       result_tuple;
+
+    ChardetectState *state = get_chardetect_state(fcinfo);
+    HeapTupleHeader rec;
+    bool            force = PG_GETARG_BOOL(1);
+    Oid             rectype;
+    int32           rectypmod;
+    Oid             relid;
+    TupleDesc       rowdesc;
+    HeapTupleData   tuple;
+    Datum           newrec;
+
+    int             *columns;
+    Datum           *values;
+    bool            *nulls;
+    Datum           *changed;
+    int             nreplaced = 0;
+    int             i;
+
+    if (!type_is_rowtype(get_fn_expr_argtype(fcinfo->flinfo, 0)))
+        ereport(ERROR,
+            (errcode(ERRCODE_DATATYPE_MISMATCH),
+             errmsg("convert_record_to_utf8: argument must be a row")));
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    BlessTupleDesc(tupdesc);
+
+    rec = PG_GETARG_HEAPTUPLEHEADER(0);
+    newrec = PointerGetDatum(rec);
+    rectype = HeapTupleHeaderGetTypeId(rec);
+    rectypmod = HeapTupleHeaderGetTypMod(rec);
+    relid = get_typ_typrelid(rectype);
+
+    // from the type cache
+    rowdesc = lookup_rowtype_tupdesc(rectype, rectypmod);
+
+    if (state->record_type != rectype || state->record_typmod != rectypmod)
+        resolve_record_columns(state, fcinfo->flinfo->fn_mcxt, rowdesc, rectype, rectypmod);
+
+    tuple.t_len = HeapTupleHeaderGetDatumLength(rec);
+    ItemPointerSetInvalid(&(tuple.t_self));
+    tuple.t_tableOid = InvalidOid;
+    tuple.t_data = rec;
+
+    columns = palloc(Max(state->record_ncolumns, 1) * sizeof(int));
+    values = palloc(Max(state->record_ncolumns, 1) * sizeof(Datum));
+    nulls = palloc(Max(state->record_ncolumns, 1) * sizeof(bool));
+    changed = palloc(Max(state->record_ncolumns, 1) * sizeof(Datum));
+
+    for (i = 0; i < state->record_ncolumns; i++)
+    {
+        int             attnum = state->record_columns[i];
+        bool            isnull;
+        Datum           value = heap_getattr(&tuple, attnum, rowdesc, &isnull);
+        ColumnDecision  decision = {COLUMN_DETECT, ""};
+        ConvertResult   result;
+
+        if (isnull)
+            continue;
+
+        if (InvalidOid != relid)
+            column_decision_lookup(relid, attnum, &decision);
+
+        convert_column(state, value, &decision, force, &result);
+
+        if (NULL == result.text_out)
+            continue;
+
+        columns[nreplaced] = attnum;
+        values[nreplaced] = PointerGetDatum(result.text_out);
+        nulls[nreplaced] = false;
+        changed[nreplaced] = CStringGetTextDatum(NameStr(TupleDescAttr(rowdesc, attnum - 1)->attname));
+        nreplaced++;
+    }
+
+    if (nreplaced > 0)
+        newrec = HeapTupleGetDatum(heap_modify_tuple_by_cols(&tuple, rowdesc, nreplaced, columns, values, nulls));
+
+    ReleaseTupleDesc(rowdesc);
+
+    result_values[0] = newrec;
+    result_values[1] = PointerGetDatum(construct_array(changed, nreplaced, TEXTOID, -1, false, TYPALIGN_INT));
+    memset(result_nulls, 0, sizeof(result_nulls));
+
+    result_tuple = heap_form_tuple(tupdesc, result_values, result_nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(result_tuple));
+}
+
+/*
+Picks the text and varchar columns of row type rectype, described by
+rowdesc, and keeps them in state for the rest of the query.
+*/
+void
+resolve_record_columns(ChardetectState* state, MemoryContext context, TupleDesc rowdesc, Oid rectype, int32 rectypmod)
+{
+    int *columns = MemoryContextAlloc(context, Max(rowdesc->natts, 1) * sizeof(int));
+    int ncolumns = 0;
+    int i;
+
+    for (i = 0; i < rowdesc->natts; i++)
+    {
+        Form_pg_attribute attr = TupleDescAttr(rowdesc, i);
+
+        if (!attr->attisdropped && is_text_type(attr->atttypid))
+            columns[ncolumns++] = attr->attnum;
+    }
+
+    if (NULL != state->record_columns)
+        pfree(state->record_columns);
+
+    state->record_columns = columns;
+    state->record_ncolumns = ncolumns;
+    state->record_type = rectype;
+    state->record_typmod = rectypmod;
+}
+
+
+
+/*
+pg_chardetect_convert_batch_trigger() statement trigger.
+
+For bulk loads a row trigger costs one call, with its setup, per row.  This
+AFTER INSERT OR UPDATE ... FOR EACH STATEMENT trigger instead reads the
+statement's NEW TABLE transition table through a cursor, converts the
+listed columns (all text and varchar columns if none are listed) of every
+row with one shared set of converters, and writes back only the rows that
+changed, CONVERT_BATCH_ROWS at a time, each batch with a single
+
+    UPDATE rel AS t SET col = coalesce(v.c1, t.col), ...
+      FROM unnest($1, ..., $n) AS v(k1, ..., c1, ...)
+     WHERE t.key = v.k1 ...
+
+Rows are matched on the replica identity key, by default the primary key,
+so the table must have one.  The UPDATE fires the trigger again if it is
+also defined for UPDATE, but finds nothing left to convert.
+
+    CREATE TRIGGER convert_after_load AFTER INSERT ON test
+        REFERENCING NEW TABLE AS new_rows
+        FOR EACH STATEMENT EXECUTE PROCEDURE pg_chardetect_convert_batch_trigger(convert_this);
+*/
+
+// rows fetched from the transition table at a time
+#define CONVERT_FETCH_ROWS 1000
+// changed rows written back with one UPDATE
+#define CONVERT_BATCH_ROWS 10000
+
+PG_FUNCTION_INFO_V1(pg_chardetect_convert_batch_trigger);
+
+Datum
+pg_chardetect_convert_batch_trigger(PG_FUNCTION_ARGS)
+{
+    TriggerData     *trigdata = (TriggerData *) fcinfo->context;
+    Relation        relation;
+    ChardetectState *state;
+    ConvertBatch    batch;
+    Bitmapset       *key_attrs;
+    const char      **names;
+    Oid             *key_types;
+    int             nkeys;
+    int             attnum;
+    StringInfoData  query;
+    Portal          cursor;
+    MemoryContext   scratch;
+    int             i;
+
+    if (!CALLED_AS_TRIGGER(fcinfo))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_batch_trigger: not called by trigger manager")));
+
+    if (!TRIGGER_FIRED_AFTER(trigdata->tg_event) || !TRIGGER_FIRED_FOR_STATEMENT(trigdata->tg_event))
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_batch_trigger: must be fired after event, for each statement")));
+
+    if (NULL == trigdata->tg_newtable || NULL == trigdata->tg_trigger->tgnewtable)
+        ereport(ERROR,
+            (errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+             errmsg("pg_chardetect_convert_batch_trigger: must be declared with REFERENCING NEW TABLE")));
+
+    relation = trigdata->tg_relation;
+    state = get_chardetect_state(fcinfo);
+
+    if (state->trigger_oid != trigdata->tg_trigger->tgoid)
+        resolve_trigger_columns(state, fcinfo->flinfo->fn_mcxt, trigdata->tg_trigger, relation);
+
+    if (0 == state->trigger_ncolumns)
+        return PointerGetDatum(NULL);
+
+    // rows are matched on the replica identity key
+    key_attrs = RelationGetIndexAttrBitmap(relation, INDEX_ATTR_BITMAP_IDENTITY_KEY);
+
+    if (bms_is_empty(key_attrs))
+        ereport(ERROR,
+            (errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+             errmsg("pg_chardetect_convert_batch_trigger: relation \"%s\" has no primary key or replica identity index",
+                    RelationGetRelationName(relation))));
+
+    nkeys = bms_num_members(key_attrs);
+    names = palloc((nkeys + state->trigger_ncolumns) * sizeof(char*));
+    key_types = palloc(nkeys * sizeof(Oid));
+
+    i = 0;
+    attnum = -1;
+    while ((attnum = bms_next_member(key_attrs, attnum)) >= 0)
+    {
+        Form_pg_attribute attr = TupleDescAttr(relation->rd_att, attnum + FirstLowInvalidHeapAttributeNumber - 1);
+
+        names[i] = NameStr(attr->attname);
+        key_types[i++] = attr->atttypid;
+    }
+
+    for (i = 0; i < state->trigger_ncolumns; i++)
+        names[nkeys + i] = NameStr(TupleDescAttr(relation->rd_att, state->trigger_columns[i] - 1)->attname);
+
+    convert_batch_init(&batch,
+                       quote_qualified_identifier(get_namespace_name(RelationGetNamespace(relation)),
+                                                  RelationGetRelationName(relation)),
+                       nkeys, names, key_types, state->trigger_ncolumns, names + nkeys, true);
+
+    for (i = 0; i < state->trigger_ncolumns; i++)
+        column_decision_lookup(RelationGetRelid(relation), state->trigger_columns[i], &batch.decisions[i]);
+
+    // SELECT k1, ..., c1, ... FROM new_table
+    initStringInfo(&query);
+    appendStringInfo(&query, "SELECT %s FROM %s", batch.select_list,
+                     quote_identifier(trigdata->tg_trigger->tgnewtable));
+
+    scratch = AllocSetContextCreate(CurrentMemoryContext,
+                                    "pg_chardetect row",
+                                    ALLOCSET_DEFAULT_SIZES);
+
+    if (SPI_connect() != SPI_OK_CONNECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_batch_trigger: SPI_connect failed")));
+
+    SPI_register_trigger_data(trigdata);
+
+    cursor = SPI_cursor_open_with_args(NULL, query.data, 0, NULL, NULL, NULL, true, 0);
+
+    for (;;)
+    {
+        uint64 row;
 
-        // bail on zero-length strings
-        // return if cbuffer has zero length or contains a blank space
-        if ((0 == cbuffer_len) || (0 == strcmp("", cbuffer)))
+        SPI_cursor_fetch(cursor, true, CONVERT_FETCH_ROWS);
+
+        if (0 == SPI_processed)
+            break;
+
+        for (row = 0; row < SPI_processed; row++)
         {
-            text_out = (text *) buffer;
-            converted = true;
-            dropped_bytes = false;
+            HeapTuple       tuple = SPI_tuptable->vals[row];
+            TupleDesc       tupdesc = SPI_tuptable->tupdesc;
+            MemoryContext   oldcontext = MemoryContextSwitchTo(scratch);
+
+            convert_batch_row(&batch, state, tuple, tupdesc);
+
+            MemoryContextSwitchTo(oldcontext);
+            MemoryContextReset(scratch);
+
+            if (batch.nrows >= CONVERT_BATCH_ROWS)
+                convert_batch_apply(&batch);
         }
-        else
-        {
-            // UTF8 output can be up to 6 bytes per input byte
-            // palloc0 allocates and zeros bytes in array
-            int32_t converted_buf_len = cbuffer_len * 6 * sizeof(char);
-            converted_buf = (char *) palloc0(converted_buf_len);
-            // int32_t converted_len = 0;
 
-            // detect encoding with ICU
-            status = detect_ICU(buffer, &encoding, &lang, &confidence);
+        SPI_freetuptable(SPI_tuptable);
+    }
 
-            ereport(DEBUG1,
-                (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-                 errmsg("ICU detection status: %d\n", status)));
+    SPI_cursor_close(cursor);
 
-            ereport(DEBUG1,
-                (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-                 errmsg("Detected encoding: %s, language: %s, confidence: %d\n",
-                 text_to_cstring(encoding),
-                 text_to_cstring(lang),
-                         confidence)));
-
-            // return without attempting a conversion if UTF8 is detected
-            if (
-                (0 == strcmp("UTF-8", text_to_cstring(encoding))) ||
-                (0 == strcmp("utf-8", text_to_cstring(encoding))) ||
-                (0 == strcmp("UTF8", text_to_cstring(encoding)))  ||
-                (0 == strcmp("utf8", text_to_cstring(encoding)))
-               )
-            {
-                ereport(DEBUG1,
-                    (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-                     errmsg("ICU detected %s.  No conversion necessary.\n", text_to_cstring(encoding))));
+    if (batch.nrows > 0)
+        convert_batch_apply(&batch);
 
-                text_out = (text *) buffer;
-                converted = true;
-                dropped_bytes = false;
-            }
-            else
-            {
-                // ICU uses UTF16 internally, so need to convert to Unicode first
-                // then convert to UTF8
+    SPI_finish();
+    MemoryContextDelete(scratch);
 
-                if (U_SUCCESS(status))
-                    status = convert_to_unicode(buffer, (const text*) encoding, &uBuf, (int32_t*) &uBuf_len, force, &dropped_bytes_toU);
+    return PointerGetDatum(NULL);
+}
 
-                if (U_SUCCESS(status))
-                    status = convert_to_utf8((const UChar*) uBuf, uBuf_len, &converted_buf, (int32_t*) &converted_buf_len, force, &dropped_bytes_fromU);
+/*
+Sets up batch for the key and column names of the table target, which may
+be qualified or prefixed with ONLY, and builds the UPDATE that applies it.
+Values are force converted if force is set.
+*/
+void
+convert_batch_init(ConvertBatch* batch, const char* target, int nkeys, const char** key_names, const Oid* key_types, int ncolumns, const char** column_names, bool force)
+{
+    StringInfoData select_list;
+    StringInfoData update;
+    int         nargs = nkeys + ncolumns;
+    int         i;
 
-                if (U_SUCCESS(status))
-                {
-                    text_out = cstring_to_text(converted_buf);
-                    converted = true;
-                    dropped_bytes = (dropped_bytes_toU || dropped_bytes_fromU);
-                }
-                else
-                {
-                    ereport(WARNING,
-                        (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
-                            errmsg("ICU conversion failed - returning original input")));
+    memset(batch, 0, sizeof(ConvertBatch));
+    batch->context = CurrentMemoryContext;
+    batch->nkeys = nkeys;
+    batch->ncolumns = ncolumns;
+    batch->force = force;
 
-                    text_out = (text *) buffer;
-                    converted = false;
-                    dropped_bytes = false;
-                }
-            } // already UTF8
-        } // zero-length string
-    }  // return if buffer is NULL
+    batch->decisions = palloc0(ncolumns * sizeof(ColumnDecision));
+    batch->keys = palloc0(nkeys * sizeof(ArrayBuildState*));
+    batch->values = palloc0(ncolumns * sizeof(ArrayBuildState*));
+    batch->argtypes = palloc(nargs * sizeof(Oid));
 
-    values[0] = PointerGetDatum(text_out);
-    values[1] = BoolGetDatum(converted);
-    values[2] = BoolGetDatum(dropped_bytes);
+    initStringInfo(&select_list);
+    for (i = 0; i < nargs; i++)
+        appendStringInfo(&select_list, "%s%s", (i > 0) ? ", " : "",
+                         quote_identifier((i < nkeys) ? key_names[i] : column_names[i - nkeys]));
 
-    // check if pointers are still NULL; if so Datum is NULL and
-    // confidence is meaningless (also NULL)
-    (text_out  == NULL || ! VARSIZE_ANY_EXHDR(text_out)) ? (nulls[0] = true) : (nulls[0] = false);
-    // converted will never be NULL
-    nulls[1] = false;
-    nulls[2] = false;
+    batch->select_list = select_list.data;
 
-    // build tuple from datum array
-    tuple = heap_form_tuple(tupdesc, values, nulls);
+    initStringInfo(&update);
+    appendStringInfo(&update, "UPDATE %s AS t SET ", target);
 
-    // cleanup
-    if (NULL != encoding)
-        pfree((void *) encoding);
+    for (i = 0; i < ncolumns; i++)
+    {
+        const char* name = quote_identifier(column_names[i]);
 
-    if (NULL != lang)
-        pfree((void *) lang);
+        // unchanged columns are NULL in the batch
+        appendStringInfo(&update, "%s%s = coalesce(v.c%d, t.%s)", (i > 0) ? ", " : "", name, i + 1, name);
+        batch->argtypes[nkeys + i] = TEXTARRAYOID;
+    }
 
-    if (NULL != cbuffer)
-        pfree((void *) cbuffer);
+    appendStringInfoString(&update, " FROM unnest(");
+    for (i = 0; i < nargs; i++)
+        appendStringInfo(&update, "%s$%d", (i > 0) ? ", " : "", i + 1);
 
-    if (NULL != converted_buf)
-        pfree((void *) converted_buf);
+    appendStringInfoString(&update, ") AS v(");
+    for (i = 0; i < nargs; i++)
+        appendStringInfo(&update, "%s%c%d", (i > 0) ? ", " : "",
+                         (i < nkeys) ? 'k' : 'c', (i < nkeys) ? i + 1 : i - nkeys + 1);
 
-    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+    appendStringInfoString(&update, ") WHERE ");
+    for (i = 0; i < nkeys; i++)
+    {
+        batch->argtypes[i] = get_array_type(key_types[i]);
+        if (InvalidOid == batch->argtypes[i])
+            ereport(ERROR,
+                (errcode(ERRCODE_DATATYPE_MISMATCH),
+                 errmsg("pg_chardetect: key column \"%s\" has no array type", key_names[i])));
+
+        appendStringInfo(&update, "%st.%s = v.k%d", (i > 0) ? " AND " : "",
+                         quote_identifier(key_names[i]), i + 1);
+    }
+
+    batch->update = update.data;
 }
 
-/* by reference, variable length */
+/*
+Converts the columns of one row, which holds the key columns followed by
+the columns to convert, as listed in batch->select_list, and adds it to
+batch if any of them changed.
+*/
+void
+convert_batch_row(ConvertBatch* batch, ChardetectState* state, HeapTuple tuple, TupleDesc tupdesc)
+{
+    Datum   *values = palloc(batch->ncolumns * sizeof(Datum));
+    bool    *nulls = palloc(batch->ncolumns * sizeof(bool));
+    bool    changed = false;
+    int     i;
 
-PG_FUNCTION_INFO_V1(char_set_detect);
+    for (i = 0; i < batch->ncolumns; i++)
+    {
+        bool            isnull;
+        Datum           value = SPI_getbinval(tuple, tupdesc, batch->nkeys + i + 1, &isnull);
+        ConvertResult   result;
 
-Datum
-char_set_detect(PG_FUNCTION_ARGS)
+        values[i] = (Datum) 0;
+        nulls[i] = true;
+
+        if (isnull)
+            continue;
+
+        convert_column(state, value, &batch->decisions[i], batch->force, &result);
+
+        if (NULL != result.text_out)
+        {
+            values[i] = PointerGetDatum(result.text_out);
+            nulls[i] = false;
+            changed = true;
+        }
+    }
+
+    if (!changed)
+        return;
+
+    // the array states copy the values into batch->context
+    for (i = 0; i < batch->nkeys; i++)
+    {
+        bool    isnull;
+        Datum   key = SPI_getbinval(tuple, tupdesc, i + 1, &isnull);
+
+        batch->keys[i] = accumArrayResult(batch->keys[i], key, isnull,
+                                          SPI_gettypeid(tupdesc, i + 1), batch->context);
+    }
+
+    for (i = 0; i < batch->ncolumns; i++)
+        batch->values[i] = accumArrayResult(batch->values[i], values[i], nulls[i],
+                                            TEXTOID, batch->context);
+
+    batch->nrows++;
+}
+
+/*
+Writes the rows collected in batch back with one UPDATE and empties it.
+*/
+void
+convert_batch_apply(ConvertBatch* batch)
 {
-    // things we need to deal with constructing our composite type
-    TupleDesc   tupdesc;
-    Datum       values[3];
-    bool        nulls[3];
-    HeapTuple   tuple;
+    int     nargs = batch->nkeys + batch->ncolumns;
+    Datum   *args = palloc(nargs * sizeof(Datum));
+    int     ret;
+    int     i;
 
-    text        *encoding = NULL;
-    text        *lang = NULL;
-    int32_t     confidence = 0;
-    UErrorCode  status = U_ZERO_ERROR;
+    for (i = 0; i < batch->nkeys; i++)
+    {
+        args[i] = makeArrayResult(batch->keys[i], batch->context);
+        batch->keys[i] = NULL;
+    }
 
-    const text  *buffer = PG_GETARG_TEXT_P(0);
+    for (i = 0; i < batch->ncolumns; i++)
+    {
+        args[batch->nkeys + i] = makeArrayResult(batch->values[i], batch->context);
+        batch->values[i] = NULL;
+    }
 
-    // Convert this value into a PostgreSQL composite type.
+    ret = SPI_execute_with_args(batch->update, nargs, batch->argtypes, args, NULL, false, 0);
 
-    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    if (ret != SPI_OK_UPDATE)
         ereport(ERROR,
-            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
-              errmsg("function returning record called in context "
-                     "that cannot accept type record")));
-
-    // BlessTupleDesc for Datums
-    BlessTupleDesc(tupdesc);
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect: batch UPDATE failed: %s", SPI_result_code_string(ret))));
 
-    status = detect_ICU(buffer, &encoding, &lang, &confidence);
     ereport(DEBUG1,
         (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-         errmsg("ICU detection status: %d\n", status)));
+         errmsg("Converted %d rows, updated " UINT64_FORMAT ".\n", batch->nrows, SPI_processed)));
 
-    ereport(DEBUG1,
-        (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
-         errmsg("Detected encoding: %s, length: %d\n", text_to_cstring(encoding), VARSIZE_ANY_EXHDR(encoding))));
+    for (i = 0; i < nargs; i++)
+        pfree(DatumGetPointer(args[i]));
+    pfree(args);
 
-    values[0] = PointerGetDatum(encoding);
-    values[1] = PointerGetDatum(lang);
-    values[2] = Int32GetDatum(confidence);
+    batch->nrows = 0;
+}
 
-    // check if pointers are still NULL; if so Datum is NULL and
-    // confidence is meaningless (also NULL)
-    (encoding == NULL || ! VARSIZE_ANY_EXHDR(encoding)) ? (nulls[0] = true) : (nulls[0] = false);
-    (lang == NULL || ! VARSIZE_ANY_EXHDR(lang))         ? (nulls[1] = true) : (nulls[1] = false);
-    (nulls[0] == true)                                  ? (nulls[2] = true) : (nulls[2] = false);
 
-    // build tuple from datum array
-    tuple = heap_form_tuple(tupdesc, values, nulls);
 
-    // cleanup
-    encoding ? pfree(encoding) : NULL;
-    lang ? pfree(lang) : NULL;
+/*
+pg_chardetect_convert_table() bulk converter.
+
+Converting a big table with a single UPDATE rewrites every row in one huge
+transaction and holds it for the whole time.  pg_chardetect_convert_table()
+instead splits the table's blocks into one range per worker, records the
+ranges in pg_chardetect_convert_progress, and starts a dynamic background
+worker for each.  A worker converts its range a few blocks at a time:
+
+    - reads the rows of the next block by ctid, with a TID range scan on
+      PostgreSQL 14 and later and a TID list on 13,
+    - converts the text columns, and writes back only the rows that
+      changed with one UPDATE matched on ctid, as the batch trigger does,
+    - moves next_block on in the progress table and commits,
+
+once at least batch_rows rows were read, then sleeps sleep_ms, or as long
+as it takes to keep the WAL written during the batch under
+max_wal_bytes_per_sec.  The WAL measured is that of the whole cluster, so
+the workers also back off while others are busy.
+
+Rows updated by someone else after a worker read them are skipped, since
+the UPDATE no longer finds them by ctid; rows inserted after the run
+started, beyond the last block, are not visited.  A row trigger takes
+care of those.
+
+A worker that is stopped, crashes or fails leaves its range at the last
+committed batch, and calling pg_chardetect_convert_table() again on the
+table starts a worker for each unfinished range instead of a new run.
+
+Workers run as the calling role, in the calling database, with the default
+pg_chardetect settings.
+*/
 
-    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+#define PROGRESS_TABLE "pg_chardetect_convert_progress"
+// schema pg_chardetect.sql creates the table in, whatever the search path
+#define PROGRESS_SCHEMA "public"
+
+PG_FUNCTION_INFO_V1(pg_chardetect_convert_table);
+
+Datum
+pg_chardetect_convert_table(PG_FUNCTION_ARGS)
+{
+    Oid             relid = PG_GETARG_OID(0);
+    ArrayType       *column_array = PG_GETARG_ARRAYTYPE_P(1);
+    int32           nworkers = PG_GETARG_INT32(2);
+    ConvertWorkerArgs args;
+    Relation        relation;
+    Datum           *elems;
+    bool            *elem_nulls;
+    int             nelems;
+    const char      **names;
+    int             *columns;
+    int             ncolumns;
+    Datum           *column_names;
+    ArrayType       *column_names_array;
+    BlockNumber     nblocks;
+    char            *relname;
+    char            *progress;
+    StringInfoData  query;
+    Oid             argtypes[4] = {OIDOID, INT8OID, INT8OID, TEXTARRAYOID};
+    Datum           values[4];
+    int64           *ranges;
+    int             nranges;
+    int             nlaunched = 0;
+    bool            inserted = false;
+    Oid             nspid;
+    int             ret;
+    int             i;
+
+    memset(&args, 0, sizeof(ConvertWorkerArgs));
+    args.relid = relid;
+    args.batch_rows = PG_GETARG_INT32(3);
+    args.force = PG_GETARG_BOOL(4);
+    args.sleep_ms = PG_GETARG_INT32(5);
+    args.max_wal_bytes_per_sec = PG_GETARG_INT64(6);
+
+    if (nworkers < 1 || args.batch_rows < 1 || args.sleep_ms < 0 || args.max_wal_bytes_per_sec < 0)
+        ereport(ERROR,
+            (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+             errmsg("pg_chardetect_convert_table: workers and batch_rows must be positive, "
+                    "sleep_ms and max_wal_bytes_per_sec must not be negative")));
+
+    nspid = get_namespace_oid(PROGRESS_SCHEMA, true);
+    args.progress_relid = OidIsValid(nspid) ? get_relname_relid(PROGRESS_TABLE, nspid) : InvalidOid;
+    if (InvalidOid == args.progress_relid)
+        ereport(ERROR,
+            (errcode(ERRCODE_UNDEFINED_TABLE),
+             errmsg("pg_chardetect_convert_table: table \"%s.%s\" does not exist", PROGRESS_SCHEMA, PROGRESS_TABLE)));
+
+    progress = qualified_relation_name(args.progress_relid);
+
+    relation = relation_open(relid, AccessShareLock);
+
+    if (RELKIND_RELATION != relation->rd_rel->relkind)
+        ereport(ERROR,
+            (errcode(ERRCODE_WRONG_OBJECT_TYPE),
+             errmsg("pg_chardetect_convert_table: \"%s\" is not a table", RelationGetRelationName(relation)),
+             errhint("Convert the partitions of a partitioned table one by one.")));
+
+    deconstruct_array(column_array, TEXTOID, -1, false, TYPALIGN_INT, &elems, &elem_nulls, &nelems);
+
+    names = palloc(Max(nelems, 1) * sizeof(char*));
+    for (i = 0; i < nelems; i++)
+    {
+        if (elem_nulls[i])
+            ereport(ERROR,
+                (errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+                 errmsg("pg_chardetect_convert_table: column names must not be NULL")));
+
+        names[i] = TextDatumGetCString(elems[i]);
+    }
+
+    columns = palloc(Max(nelems, relation->rd_att->natts) * sizeof(int));
+    ncolumns = resolve_columns("pg_chardetect_convert_table", relation, names, nelems, columns);
+
+    column_names = palloc(Max(ncolumns, 1) * sizeof(Datum));
+    for (i = 0; i < ncolumns; i++)
+        column_names[i] = CStringGetTextDatum(NameStr(TupleDescAttr(relation->rd_att, columns[i] - 1)->attname));
+
+    column_names_array = construct_array(column_names, ncolumns, TEXTOID, -1, false, TYPALIGN_INT);
+
+    nblocks = RelationGetNumberOfBlocks(relation);
+    relname = pstrdup(RelationGetRelationName(relation));
+
+    relation_close(relation, AccessShareLock);
+
+    if (0 == ncolumns)
+    {
+        ereport(NOTICE,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("pg_chardetect_convert_table: \"%s\" has no text columns to convert", relname)));
+        PG_RETURN_INT32(0);
+    }
+
+    if (SPI_connect() != SPI_OK_CONNECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_table: SPI_connect failed")));
+
+    values[0] = ObjectIdGetDatum(relid);
+
+    // resume the unfinished ranges of an interrupted run
+    initStringInfo(&query);
+    appendStringInfo(&query, "SELECT 1 FROM %s WHERE relid = $1 AND finished IS NULL", progress);
+
+    ret = SPI_execute_with_args(query.data, 1, argtypes, values, NULL, true, 1);
+    if (ret != SPI_OK_SELECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_table: SELECT failed: %s", SPI_result_code_string(ret))));
+
+    if (SPI_processed > 0)
+        ereport(NOTICE,
+            (errcode(ERRCODE_SUCCESSFUL_COMPLETION),
+             errmsg("pg_chardetect_convert_table: resuming the unfinished conversion of \"%s\"", relname)));
+    else
+    {
+        resetStringInfo(&query);
+        appendStringInfo(&query, "DELETE FROM %s WHERE relid = $1", progress);
+
+        ret = SPI_execute_with_args(query.data, 1, argtypes, values, NULL, false, 0);
+        if (ret != SPI_OK_DELETE)
+            ereport(ERROR,
+                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                 errmsg("pg_chardetect_convert_table: DELETE failed: %s", SPI_result_code_string(ret))));
+
+        resetStringInfo(&query);
+        appendStringInfo(&query,
+                         "INSERT INTO %s (relid, range_start, range_end, next_block, columns) "
+                         "VALUES ($1, $2, $3, $2, $4)", progress);
+
+        values[3] = PointerGetDatum(column_names_array);
+
+        for (i = 0; i < nworkers; i++)
+        {
+            int64 start = (int64) nblocks * i / nworkers;
+            int64 end = (int64) nblocks * (i + 1) / nworkers;
+
+            // more workers than blocks
+            if (start == end)
+                continue;
+
+            values[1] = Int64GetDatum(start);
+            values[2] = Int64GetDatum(end);
+
+            ret = SPI_execute_with_args(query.data, 4, argtypes, values, NULL, false, 0);
+            if (ret != SPI_OK_INSERT)
+                ereport(ERROR,
+                    (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                     errmsg("pg_chardetect_convert_table: INSERT failed: %s", SPI_result_code_string(ret))));
+
+            inserted = true;
+        }
+    }
+
+    resetStringInfo(&query);
+    appendStringInfo(&query,
+                     "SELECT range_start FROM %s WHERE relid = $1 AND finished IS NULL "
+                     "ORDER BY range_start", progress);
+
+    ret = SPI_execute_with_args(query.data, 1, argtypes, values, NULL, false, 0);
+    if (ret != SPI_OK_SELECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_table: SELECT failed: %s", SPI_result_code_string(ret))));
+
+    nranges = (int) SPI_processed;
+    ranges = SPI_palloc(Max(nranges, 1) * sizeof(int64));
+
+    for (i = 0; i < nranges; i++)
+    {
+        bool isnull;
+
+        ranges[i] = DatumGetInt64(SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 1, &isnull));
+    }
+
+    SPI_finish();
+
+    // the workers wait for this transaction to commit the new progress
+    // rows; resuming wrote nothing, so it neither needs an XID nor a wait
+    args.dboid = MyDatabaseId;
+    args.roleoid = GetUserId();
+    args.launcher_xid = inserted ? GetTopTransactionId() : InvalidTransactionId;
+
+    for (i = 0; i < nranges; i++)
+    {
+        BackgroundWorker worker;
+
+        args.range_start = ranges[i];
+
+        memset(&worker, 0, sizeof(BackgroundWorker));
+        worker.bgw_flags = BGWORKER_SHMEM_ACCESS | BGWORKER_BACKEND_DATABASE_CONNECTION;
+        worker.bgw_start_time = BgWorkerStart_RecoveryFinished;
+        worker.bgw_restart_time = BGW_NEVER_RESTART;
+        snprintf(worker.bgw_library_name, sizeof(worker.bgw_library_name), "pg_chardetect");
+        snprintf(worker.bgw_function_name, sizeof(worker.bgw_function_name), "pg_chardetect_convert_worker");
+        snprintf(worker.bgw_name, sizeof(worker.bgw_name), "pg_chardetect convert %s from block " INT64_FORMAT,
+                 relname, ranges[i]);
+        snprintf(worker.bgw_type, sizeof(worker.bgw_type), "pg_chardetect convert");
+        worker.bgw_notify_pid = MyProcPid;
+
+        StaticAssertStmt(sizeof(ConvertWorkerArgs) <= BGW_EXTRALEN, "ConvertWorkerArgs does not fit in bgw_extra");
+        memcpy(worker.bgw_extra, &args, sizeof(ConvertWorkerArgs));
+
+        if (!RegisterDynamicBackgroundWorker(&worker, NULL))
+            break;
+
+        nlaunched++;
+    }
+
+    if (nlaunched < nranges)
+        ereport(WARNING,
+            (errcode(ERRCODE_INSUFFICIENT_RESOURCES),
+             errmsg("pg_chardetect_convert_table: could only start %d of %d workers", nlaunched, nranges),
+             errhint("Raise max_worker_processes, or call pg_chardetect_convert_table() again "
+                     "when the workers are done to convert the remaining ranges.")));
+
+    PG_RETURN_INT32(nlaunched);
+}
+
+/*
+Returns the quoted, schema qualified name of relid, or NULL if it no
+longer exists.
+*/
+char*
+qualified_relation_name(Oid relid)
+{
+    char* relname = get_rel_name(relid);
+
+    if (NULL == relname)
+        return NULL;
+
+    return quote_qualified_identifier(get_namespace_name(get_rel_namespace(relid)), relname);
+}
+
+/*
+Background worker converting one block range of a table, started by
+pg_chardetect_convert_table().
+*/
+void
+pg_chardetect_convert_worker(Datum main_arg)
+{
+    ConvertWorkerArgs   args;
+    ChardetectState     *state;
+    MemoryContext       scratch;
+    bool                done = false;
+
+    memcpy(&args, MyBgworkerEntry->bgw_extra, sizeof(ConvertWorkerArgs));
+
+    pqsignal(SIGTERM, die);
+    BackgroundWorkerUnblockSignals();
+
+    BackgroundWorkerInitializeConnectionByOid(args.dboid, args.roleoid, 0);
+
+    state = create_chardetect_state(TopMemoryContext);
+    scratch = AllocSetContextCreate(TopMemoryContext,
+                                    "pg_chardetect row",
+                                    ALLOCSET_DEFAULT_SIZES);
+
+    // a new range is not visible until the launching transaction commits;
+    // if it rolls back, the worker finds nothing to do
+    if (TransactionIdIsValid(args.launcher_xid))
+    {
+        StartTransactionCommand();
+        XactLockTableWait(args.launcher_xid, NULL, NULL, XLTW_None);
+        CommitTransactionCommand();
+    }
+
+    while (!done)
+    {
+        XLogRecPtr  wal_start = GetXLogInsertRecPtr();
+        TimestampTz batch_start = GetCurrentTimestamp();
+
+        CHECK_FOR_INTERRUPTS();
+
+        SetCurrentStatementStartTimestamp();
+        StartTransactionCommand();
+        if (SPI_connect() != SPI_OK_CONNECT)
+            ereport(ERROR,
+                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                 errmsg("pg_chardetect_convert_worker: SPI_connect failed")));
+        PushActiveSnapshot(GetTransactionSnapshot());
+        pgstat_report_activity(STATE_RUNNING, "pg_chardetect_convert_table()");
+
+        done = convert_worker_batch(state, &args, scratch);
+
+        SPI_finish();
+        PopActiveSnapshot();
+        CommitTransactionCommand();
+        pgstat_report_stat(false);
+        pgstat_report_activity(STATE_IDLE, NULL);
+
+        if (!done)
+            convert_worker_throttle(&args, wal_start, batch_start);
+    }
+
+    proc_exit(0);
+}
+
+/*
+Converts the next batch of the worker's range and records the progress,
+all in the current transaction.  Returns true when the range is done, or
+there is nothing to do: it was finished, or is being converted by another
+worker, or the table was dropped.
+*/
+bool
+convert_worker_batch(ChardetectState* state, const ConvertWorkerArgs* args, MemoryContext scratch)
+{
+    char            *progress = qualified_relation_name(args->progress_relid);
+    char            *relname = qualified_relation_name(args->relid);
+    StringInfoData  query;
+    Oid             progress_types[5] = {OIDOID, INT8OID, INT8OID, INT8OID, INT8OID};
+    Datum           progress_values[5];
+    HeapTuple       tuple;
+    TupleDesc       tupdesc;
+    bool            isnull;
+    int64           block;
+    int64           range_end;
+    ArrayType       *column_array;
+    Datum           *elems;
+    int             ncolumns;
+    const char      **names;
+    const char      *key_name = "ctid";
+    Oid             key_type = TIDOID;
+    ConvertBatch    batch;
+    SPIPlanPtr      plan;
+    Oid             plan_types[2] = {TIDOID, TIDOID};
+    int64           rows_seen = 0;
+    int64           rows_converted = 0;
+    int             ret;
+    int             i;
+
+    if (NULL == progress)
+        return true;
+
+    progress_values[0] = ObjectIdGetDatum(args->relid);
+    progress_values[1] = Int64GetDatum(args->range_start);
+
+    // lock the range, so a second worker started on it quits
+    initStringInfo(&query);
+    appendStringInfo(&query,
+                     "SELECT next_block, range_end, columns FROM %s "
+                     "WHERE relid = $1 AND range_start = $2 AND finished IS NULL "
+                     "FOR UPDATE SKIP LOCKED", progress);
+
+    ret = SPI_execute_with_args(query.data, 2, progress_types, progress_values, NULL, false, 1);
+    if (ret != SPI_OK_SELECT)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_worker: SELECT failed: %s", SPI_result_code_string(ret))));
+
+    if (0 == SPI_processed)
+        return true;
+
+    tuple = SPI_tuptable->vals[0];
+    tupdesc = SPI_tuptable->tupdesc;
+    block = DatumGetInt64(SPI_getbinval(tuple, tupdesc, 1, &isnull));
+    range_end = DatumGetInt64(SPI_getbinval(tuple, tupdesc, 2, &isnull));
+    column_array = DatumGetArrayTypeP(SPI_getbinval(tuple, tupdesc, 3, &isnull));
+
+    if (NULL != relname)
+    {
+        deconstruct_array(column_array, TEXTOID, -1, false, TYPALIGN_INT, &elems, NULL, &ncolumns);
+
+        names = palloc(Max(ncolumns, 1) * sizeof(char*));
+        for (i = 0; i < ncolumns; i++)
+            names[i] = TextDatumGetCString(elems[i]);
+
+        // inheritance children have ctids of their own
+        resetStringInfo(&query);
+        appendStringInfo(&query, "ONLY %s", relname);
+
+        convert_batch_init(&batch, query.data, 1, &key_name, &key_type, ncolumns, names, args->force);
+
+        for (i = 0; i < ncolumns; i++)
+            column_decision_lookup(args->relid, get_attnum(args->relid, names[i]), &batch.decisions[i]);
+
+        resetStringInfo(&query);
+#if PG_VERSION_NUM >= 140000
+        appendStringInfo(&query, "SELECT %s FROM ONLY %s WHERE ctid >= $1 AND ctid < $2",
+                         batch.select_list, relname);
+        plan = SPI_prepare(query.data, 2, plan_types);
+#else
+        // no TID range scans before 14: list every possible item of the block
+        appendStringInfo(&query, "SELECT %s FROM ONLY %s WHERE ctid = ANY ($1)",
+                         batch.select_list, relname);
+        plan_types[0] = TIDARRAYOID;
+        plan = SPI_prepare(query.data, 1, plan_types);
+#endif
+
+        if (NULL == plan)
+            ereport(ERROR,
+                (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                 errmsg("pg_chardetect_convert_worker: SPI_prepare failed: %s", SPI_result_code_string(SPI_result))));
+
+        for (; block < range_end && rows_seen < args->batch_rows; block++)
+        {
+            Datum   plan_values[2];
+            uint64  row;
+
+#if PG_VERSION_NUM >= 140000
+            ItemPointerData first;
+            ItemPointerData last;
+
+            ItemPointerSet(&first, (BlockNumber) block, 0);
+            ItemPointerSet(&last, (BlockNumber) (block + 1), 0);
+            plan_values[0] = PointerGetDatum(&first);
+            plan_values[1] = PointerGetDatum(&last);
+#else
+            ItemPointerData tids[MaxHeapTuplesPerPage];
+            Datum           tid_datums[MaxHeapTuplesPerPage];
+
+            for (i = 0; i < MaxHeapTuplesPerPage; i++)
+            {
+                ItemPointerSet(&tids[i], (BlockNumber) block, (OffsetNumber) (i + 1));
+                tid_datums[i] = PointerGetDatum(&tids[i]);
+            }
+
+            plan_values[0] = PointerGetDatum(construct_array(tid_datums, MaxHeapTuplesPerPage, TIDOID,
+                                                             sizeof(ItemPointerData), false, TYPALIGN_SHORT));
+#endif
+
+            ret = SPI_execute_plan(plan, plan_values, NULL, false, 0);
+            if (ret != SPI_OK_SELECT)
+                ereport(ERROR,
+                    (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+                     errmsg("pg_chardetect_convert_worker: SELECT failed: %s", SPI_result_code_string(ret))));
+
+            for (row = 0; row < SPI_processed; row++)
+            {
+                MemoryContext oldcontext = MemoryContextSwitchTo(scratch);
+
+                convert_batch_row(&batch, state, SPI_tuptable->vals[row], SPI_tuptable->tupdesc);
+
+                MemoryContextSwitchTo(oldcontext);
+                MemoryContextReset(scratch);
+            }
+
+            rows_seen += SPI_processed;
+            SPI_freetuptable(SPI_tuptable);
+
+            CHECK_FOR_INTERRUPTS();
+        }
+
+        rows_converted = batch.nrows;
+        if (batch.nrows > 0)
+            convert_batch_apply(&batch);
+    }
+    else
+    {
+        // the table is gone
+        block = range_end;
+    }
+
+    progress_values[2] = Int64GetDatum(block);
+    progress_values[3] = Int64GetDatum(rows_seen);
+    progress_values[4] = Int64GetDatum(rows_converted);
+
+    resetStringInfo(&query);
+    appendStringInfo(&query,
+                     "UPDATE %s SET next_block = $3, rows_seen = rows_seen + $4, "
+                     "rows_converted = rows_converted + $5, updated = now(), "
+                     "finished = CASE WHEN $3 >= range_end THEN now() END "
+                     "WHERE relid = $1 AND range_start = $2", progress);
+
+    ret = SPI_execute_with_args(query.data, 5, progress_types, progress_values, NULL, false, 0);
+    if (ret != SPI_OK_UPDATE)
+        ereport(ERROR,
+            (errcode(ERRCODE_EXTERNAL_ROUTINE_EXCEPTION),
+             errmsg("pg_chardetect_convert_worker: UPDATE failed: %s", SPI_result_code_string(ret))));
+
+    return block >= range_end;
+}
+
+/*
+Sleeps between batches for pg_chardetect_convert_table()'s sleep_ms, or
+longer if the WAL written since wal_start exceeds max_wal_bytes_per_sec.
+*/
+void
+convert_worker_throttle(const ConvertWorkerArgs* args, XLogRecPtr wal_start, TimestampTz batch_start)
+{
+    long    delay = args->sleep_ms;
+
+    if (args->max_wal_bytes_per_sec > 0)
+    {
+        uint64  wal_bytes = GetXLogInsertRecPtr() - wal_start;
+        long    secs;
+        int     usecs;
+        long    needed;
+
+        TimestampDifference(batch_start, GetCurrentTimestamp(), &secs, &usecs);
+
+        // the time the batch should have taken at the maximum rate
+        needed = (long) (wal_bytes * 1000 / args->max_wal_bytes_per_sec) - (secs * 1000 + usecs / 1000);
+        delay = Max(delay, needed);
+    }
+
+    if (delay > 0)
+    {
+        (void) WaitLatch(MyLatch, WL_LATCH_SET | WL_TIMEOUT | WL_EXIT_ON_PM_DEATH, delay, PG_WAIT_EXTENSION);
+        ResetLatch(MyLatch);
+    }
+
+    CHECK_FOR_INTERRUPTS();
 }
 
 
@@ -0,0 +1,308 @@
+#include "postgres.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "access/htup_details.h"
+#include "common/hashfn.h"
+#include "lib/ilist.h"
+#include "utils/hsearch.h"
+#include "utils/memutils.h"
+
+#include "resultcache.h"
+
+/*
+Per-backend cache of char_set_detect() and convert_to_UTF8() results.
+
+Tables often hold the same strings over and over, and each of them would
+otherwise be detected and converted again.  Results are kept in a hash
+table keyed by a 64 bit hash of the input bytes, their length, the kind of
+result, the detector settings and the number of bytes detection looked
+at.  Each entry also keeps a copy of the input, so a hash collision is a
+miss rather than a wrong answer.  Entries are on a list in order of use
+and the least recently used ones are evicted to stay within
+pg_chardetect.cache_entries and pg_chardetect.cache_size.
+
+Everything lives in a memory context of its own under TopMemoryContext, and
+is thrown away when the cache is disabled by setting cache_entries to 0.
+*/
+
+typedef struct ResultCacheKey
+{
+    uint64      hash;
+    int32       len;
+    int32       detect_len;     // bytes detection looked at
+    int32       detector;       // hash of the detector settings
+    int32       kind;
+} ResultCacheKey;
+
+typedef struct ResultCacheEntry
+{
+    ResultCacheKey  key;            // must be first
+    dlist_node      lru;            // head is the most recently used
+    char            *input;         // copy of the input bytes
+    Size            size;           // bytes held by the entry
+    CachedResult    result;
+} ResultCacheEntry;
+
+typedef struct ResultCacheStats
+{
+    int64       hits;
+    int64       misses;
+    int64       evictions;
+} ResultCacheStats;
+
+// GUC variables
+
+// maximum number of cached results, 0 disables the cache
+int         cache_entries = 0;
+// maximum bytes of input and results held by the cache
+int         cache_size = 8 * 1024 * 1024;
+// longer values are never cached
+int         cache_max_value_bytes = 4096;
+
+static MemoryContext cache_context = NULL;
+static HTAB *cache = NULL;
+static dlist_head cache_lru = DLIST_STATIC_INIT(cache_lru);
+static Size cache_bytes = 0;
+static ResultCacheStats cache_stats;
+
+// Forward declarations
+
+PG_FUNCTION_INFO_V1(pg_chardetect_cache_stats);
+
+uint32      result_cache_hash(const void* key, Size keysize);
+void        result_cache_init(void);
+void        result_cache_reset(void);
+void        result_cache_evict(ResultCacheEntry* entry);
+void        result_cache_free(ResultCacheEntry* entry);
+void        result_cache_make_key(ResultCacheKey* key, CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len);
+text*       result_cache_copy_text(MemoryContext context, const text* t);
+
+uint32
+result_cache_hash(const void* key, Size keysize)
+{
+    // the key already holds a good hash of the input
+    return (uint32) ((const ResultCacheKey*) key)->hash;
+}
+
+void
+result_cache_init(void)
+{
+    HASHCTL ctl;
+
+    cache_context = AllocSetContextCreate(TopMemoryContext,
+                                          "pg_chardetect result cache",
+                                          ALLOCSET_DEFAULT_SIZES);
+
+    memset(&ctl, 0, sizeof(ctl));
+    ctl.keysize = sizeof(ResultCacheKey);
+    ctl.entrysize = sizeof(ResultCacheEntry);
+    ctl.hash = result_cache_hash;
+    ctl.hcxt = cache_context;
+
+    cache = hash_create("pg_chardetect result cache", 256, &ctl,
+                        HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+    dlist_init(&cache_lru);
+    cache_bytes = 0;
+}
+
+void
+result_cache_reset(void)
+{
+    // the hash table lives in cache_context too
+    MemoryContextDelete(cache_context);
+
+    cache_context = NULL;
+    cache = NULL;
+    dlist_init(&cache_lru);
+    cache_bytes = 0;
+}
+
+bool
+result_cache_wanted(int32 len)
+{
+    if (cache_entries <= 0)
+    {
+        if (NULL != cache)
+            result_cache_reset();
+
+        return false;
+    }
+
+    return len <= cache_max_value_bytes;
+}
+
+text*
+result_cache_copy_text(MemoryContext context, const text* t)
+{
+    text* copy;
+
+    if (NULL == t)
+        return NULL;
+
+    copy = (text *) MemoryContextAlloc(context, VARSIZE_ANY(t));
+    memcpy(copy, t, VARSIZE_ANY(t));
+
+    return copy;
+}
+
+void
+result_cache_make_key(ResultCacheKey* key, CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len)
+{
+    // no padding, but clear it anyway: dynahash compares keys with memcmp
+    memset(key, 0, sizeof(*key));
+    key->hash = hash_bytes_extended((const unsigned char*) buffer, len, 0);
+    key->len = len;
+    key->detect_len = detect_len;
+    key->detector = detector;
+    key->kind = kind;
+}
+
+bool
+result_cache_lookup(CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len, CachedResult* result)
+{
+    ResultCacheKey key;
+    ResultCacheEntry* entry;
+
+    if (NULL == cache)
+    {
+        cache_stats.misses++;
+        return false;
+    }
+
+    result_cache_make_key(&key, kind, detector, detect_len, buffer, len);
+    entry = (ResultCacheEntry *) hash_search(cache, &key, HASH_FIND, NULL);
+
+    if (NULL == entry || 0 != memcmp(entry->input, buffer, len))
+    {
+        cache_stats.misses++;
+        return false;
+    }
+
+    cache_stats.hits++;
+    dlist_move_head(&cache_lru, &entry->lru);
+
+    *result = entry->result;
+    result->encoding = result_cache_copy_text(CurrentMemoryContext, entry->result.encoding);
+    result->lang = result_cache_copy_text(CurrentMemoryContext, entry->result.lang);
+    result->text_out = result_cache_copy_text(CurrentMemoryContext, entry->result.text_out);
+
+    return true;
+}
+
+void
+result_cache_free(ResultCacheEntry* entry)
+{
+    cache_bytes -= entry->size;
+
+    pfree(entry->input);
+    if (NULL != entry->result.encoding)
+        pfree(entry->result.encoding);
+    if (NULL != entry->result.lang)
+        pfree(entry->result.lang);
+    if (NULL != entry->result.text_out)
+        pfree(entry->result.text_out);
+}
+
+void
+result_cache_evict(ResultCacheEntry* entry)
+{
+    dlist_delete(&entry->lru);
+    result_cache_free(entry);
+    hash_search(cache, &entry->key, HASH_REMOVE, NULL);
+
+    cache_stats.evictions++;
+}
+
+void
+result_cache_store(CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len, const CachedResult* result)
+{
+    ResultCacheKey key;
+    ResultCacheEntry* entry;
+    CachedResult copy;
+    char* input;
+    Size size;
+    bool found;
+
+    if (NULL == cache)
+        result_cache_init();
+
+    size = sizeof(ResultCacheEntry) + len;
+    if (NULL != result->encoding)
+        size += VARSIZE_ANY(result->encoding);
+    if (NULL != result->lang)
+        size += VARSIZE_ANY(result->lang);
+    if (NULL != result->text_out)
+        size += VARSIZE_ANY(result->text_out);
+
+    // would push everything else out
+    if (size > (Size) cache_size)
+        return;
+
+    // copy everything before touching the table, so running out of
+    // memory cannot leave a half built entry behind
+    copy = *result;
+    copy.encoding = result_cache_copy_text(cache_context, result->encoding);
+    copy.lang = result_cache_copy_text(cache_context, result->lang);
+    copy.text_out = result_cache_copy_text(cache_context, result->text_out);
+
+    input = MemoryContextAlloc(cache_context, Max(len, 1));
+    memcpy(input, buffer, len);
+
+    result_cache_make_key(&key, kind, detector, detect_len, buffer, len);
+    entry = (ResultCacheEntry *) hash_search(cache, &key, HASH_ENTER, &found);
+
+    // same hash, different bytes: the newer value wins
+    if (found)
+    {
+        dlist_delete(&entry->lru);
+        result_cache_free(entry);
+    }
+
+    entry->input = input;
+    entry->size = size;
+    entry->result = copy;
+
+    dlist_push_head(&cache_lru, &entry->lru);
+    cache_bytes += size;
+
+    while (hash_get_num_entries(cache) > cache_entries || cache_bytes > (Size) cache_size)
+    {
+        ResultCacheEntry* oldest = dlist_tail_element(ResultCacheEntry, lru, &cache_lru);
+
+        result_cache_evict(oldest);
+    }
+}
+
+/*
+pg_chardetect_cache_stats():
+    - returns hits, misses and evictions since the backend started, and
+      the number of entries and bytes cached now
+*/
+Datum
+pg_chardetect_cache_stats(PG_FUNCTION_ARGS)
+{
+    TupleDesc   tupdesc;
+    Datum       values[5];
+    bool        nulls[5];
+    HeapTuple   tuple;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+        ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+              errmsg("function returning record called in context "
+                     "that cannot accept type record")));
+
+    BlessTupleDesc(tupdesc);
+
+    values[0] = Int64GetDatum(cache_stats.hits);
+    values[1] = Int64GetDatum(cache_stats.misses);
+    values[2] = Int64GetDatum(cache_stats.evictions);
+    values[3] = Int64GetDatum((NULL != cache) ? hash_get_num_entries(cache) : 0);
+    values[4] = Int64GetDatum((int64) cache_bytes);
+    memset(nulls, 0, sizeof(nulls));
+
+    tuple = heap_form_tuple(tupdesc, values, nulls);
+
+    PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
+}
@@ -0,0 +1,48 @@
+#ifndef _RESULTCACHE
+#define _RESULTCACHE
+
+#include "postgres.h"
+#include "fmgr.h"
+
+// what a cached result is the result of
+typedef enum
+{
+    CACHE_DETECT,           // char_set_detect()
+    CACHE_CONVERT,          // convert_to_UTF8() without force
+    CACHE_CONVERT_FORCE     // convert_to_UTF8() with force
+} CacheKind;
+
+// a cached char_set_detect() or convert_to_UTF8() result
+typedef struct CachedResult
+{
+    // char_set_detect()
+    text        *encoding;
+    text        *lang;
+    int32       confidence;
+
+    // convert_to_UTF8()
+    text        *text_out;      // NULL to keep the input
+    bool        converted;
+    bool        dropped_bytes;
+} CachedResult;
+
+// GUC variables
+extern int  cache_entries;
+extern int  cache_size;
+extern int  cache_max_value_bytes;
+
+// true if a value of len bytes would be cached
+bool        result_cache_wanted(int32 len);
+
+// looks up the result for buffer, copying it into CurrentMemoryContext;
+// detector and detect_len identify the detector settings and the number of bytes
+// detection looks at, which the result depends on as well
+bool        result_cache_lookup(CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len, CachedResult* result);
+
+// remembers the result for buffer, evicting the least recently used
+// entries to stay within pg_chardetect.cache_entries and cache_size
+void        result_cache_store(CacheKind kind, int32 detector, int32 detect_len, const char* buffer, int32 len, const CachedResult* result);
+
+Datum       pg_chardetect_cache_stats(PG_FUNCTION_ARGS);
+
+#endif
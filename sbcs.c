@@ -0,0 +1,107 @@
+#include "sbcs.h"
+#include "utf8scan.h"
+#include <string.h>
+#include <strings.h>
+
+/*
+Native transcoding of single byte charsets to UTF-8.
+
+Every single byte charset ICU's detector reports maps ASCII to itself, so
+ASCII runs are found with the vectorized scan in utf8scan.c and copied as
+they are; every other byte is one lookup in a 256 entry table generated
+from ICU (sbcs_tables.c).  Callers size the output exactly with
+sbcs_utf8_len() first.
+*/
+
+#define IS_FLAGGED(cs, c)   ((cs)->flagged[(c) >> 3] & (1 << ((c) & 7)))
+
+const SbcsCharset*
+sbcs_lookup(const char* name)
+{
+    const SbcsCharset* cs;
+
+    for (cs = sbcs_charsets; NULL != cs->name; cs++)
+        if (0 == strcasecmp(cs->name, name))
+            return cs;
+
+    return NULL;
+}
+
+size_t
+sbcs_utf8_len(const SbcsCharset* cs, const char* buffer, size_t len, bool force)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t out = 0;
+    size_t i = 0;
+
+    while (i < len)
+    {
+        size_t run = ascii_prefix_len(buffer + i, len - i);
+
+        out += run;
+        i += run;
+
+        // everything up to the next ASCII run goes through the table
+        for (; i < len && (s[i] >= 0x80 || s[i] == 0); i++)
+            if (!force || !IS_FLAGGED(cs, s[i]))
+                out += cs->map[s[i]].len;
+    }
+
+    return out;
+}
+
+size_t
+sbcs_flagged_offset(const SbcsCharset* cs, const char* buffer, size_t len)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i = 0;
+
+    while (i < len)
+    {
+        i += ascii_prefix_len(buffer + i, len - i);
+
+        for (; i < len && (s[i] >= 0x80 || s[i] == 0); i++)
+            if (IS_FLAGGED(cs, s[i]))
+                return i;
+    }
+
+    return len;
+}
+
+size_t
+sbcs_to_utf8(const SbcsCharset* cs, const char* buffer, size_t len, bool force, char* out, bool* dropped_bytes)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    char* o = out;
+    size_t i = 0;
+    bool dropped = false;
+
+    while (i < len)
+    {
+        size_t run = ascii_prefix_len(buffer + i, len - i);
+
+        memcpy(o, buffer + i, run);
+        o += run;
+        i += run;
+
+        for (; i < len && (s[i] >= 0x80 || s[i] == 0); i++)
+        {
+            const SbcsChar* e = &cs->map[s[i]];
+
+            if (force && IS_FLAGGED(cs, s[i]))
+            {
+                dropped = true;
+                continue;
+            }
+
+            // copy the whole entry, keep only its length
+            memcpy(o, e->bytes, sizeof(e->bytes));
+            o += e->len;
+        }
+    }
+
+    if (NULL != dropped_bytes)
+        *dropped_bytes = dropped;
+
+    return o - out;
+}
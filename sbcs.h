@@ -0,0 +1,45 @@
+#ifndef _SBCS
+#define _SBCS
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// UTF-8 for one byte of a single byte charset
+typedef struct
+{
+    unsigned char   len;        // 0 to 3 bytes
+    unsigned char   bytes[3];
+} SbcsChar;
+
+// byte to UTF-8 table for a single byte charset
+typedef struct
+{
+    const char              *name;      // ICU / IANA name
+    const SbcsChar          *map;       // what ICU converts each byte to
+    const unsigned char     *flagged;   // bitmap of bytes ICU reports as
+                                        // illegal or unassigned
+} SbcsCharset;
+
+// generated tables, terminated by an entry with a NULL name
+extern const SbcsCharset sbcs_charsets[];
+
+// table for charset name, NULL if it is not a supported single byte charset
+const SbcsCharset* sbcs_lookup(const char* name);
+
+// number of UTF-8 bytes sbcs_to_utf8() writes for buffer
+size_t sbcs_utf8_len(const SbcsCharset* cs, const char* buffer, size_t len, bool force);
+
+// converts buffer to UTF-8 in out, which must have room for
+// sbcs_utf8_len() + SBCS_OUTPUT_SLACK bytes; returns the bytes written.
+// in force mode flagged bytes are dropped and dropped_bytes is set
+size_t sbcs_to_utf8(const SbcsCharset* cs, const char* buffer, size_t len, bool force, char* out, bool* dropped_bytes);
+
+// offset of the first byte of buffer ICU reports as illegal or unassigned,
+// len if there is none
+size_t sbcs_flagged_offset(const SbcsCharset* cs, const char* buffer, size_t len);
+
+// sbcs_to_utf8() stores whole table entries and may write this much past
+// the end of its output
+#define SBCS_OUTPUT_SLACK 3
+
+#endif
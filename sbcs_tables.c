@@ -0,0 +1,4316 @@
+/*
+Byte to UTF-8 tables for single byte charsets.
+
+Generated by gen_sbcs_tables from ICU 72.1 - do not edit.
+*/
+
+#include "sbcs.h"
+
+static const SbcsChar ISO_8859_1_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC2, 0xA1, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC2, 0xAA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xBF, 0x00 } },
+    { 2, { 0xC3, 0x80, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x83, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC3, 0x85, 0x00 } },
+    { 2, { 0xC3, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x88, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC3, 0x8A, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC3, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC3, 0x8F, 0x00 } },
+    { 2, { 0xC3, 0x90, 0x00 } },
+    { 2, { 0xC3, 0x91, 0x00 } },
+    { 2, { 0xC3, 0x92, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x95, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC3, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x99, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC3, 0x9D, 0x00 } },
+    { 2, { 0xC3, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xA0, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0xA3, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC3, 0xA5, 0x00 } },
+    { 2, { 0xC3, 0xA6, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC3, 0xA8, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0xAA, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC3, 0xAC, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0xAF, 0x00 } },
+    { 2, { 0xC3, 0xB0, 0x00 } },
+    { 2, { 0xC3, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xB2, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC3, 0xB5, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC3, 0xB8, 0x00 } },
+    { 2, { 0xC3, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC3, 0xBB, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC3, 0xBD, 0x00 } },
+    { 2, { 0xC3, 0xBE, 0x00 } },
+    { 2, { 0xC3, 0xBF, 0x00 } },
+};
+
+static const unsigned char ISO_8859_1_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar ISO_8859_2_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC4, 0x84, 0x00 } },
+    { 2, { 0xCB, 0x98, 0x00 } },
+    { 2, { 0xC5, 0x81, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC4, 0xBD, 0x00 } },
+    { 2, { 0xC5, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC5, 0xA0, 0x00 } },
+    { 2, { 0xC5, 0x9E, 0x00 } },
+    { 2, { 0xC5, 0xA4, 0x00 } },
+    { 2, { 0xC5, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC5, 0xBD, 0x00 } },
+    { 2, { 0xC5, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC4, 0x85, 0x00 } },
+    { 2, { 0xCB, 0x9B, 0x00 } },
+    { 2, { 0xC5, 0x82, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC4, 0xBE, 0x00 } },
+    { 2, { 0xC5, 0x9B, 0x00 } },
+    { 2, { 0xCB, 0x87, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC5, 0xA1, 0x00 } },
+    { 2, { 0xC5, 0x9F, 0x00 } },
+    { 2, { 0xC5, 0xA5, 0x00 } },
+    { 2, { 0xC5, 0xBA, 0x00 } },
+    { 2, { 0xCB, 0x9D, 0x00 } },
+    { 2, { 0xC5, 0xBE, 0x00 } },
+    { 2, { 0xC5, 0xBC, 0x00 } },
+    { 2, { 0xC5, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC4, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC4, 0xB9, 0x00 } },
+    { 2, { 0xC4, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC4, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC4, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC4, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC4, 0x8E, 0x00 } },
+    { 2, { 0xC4, 0x90, 0x00 } },
+    { 2, { 0xC5, 0x83, 0x00 } },
+    { 2, { 0xC5, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC5, 0x90, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC5, 0x98, 0x00 } },
+    { 2, { 0xC5, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC5, 0xB0, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC3, 0x9D, 0x00 } },
+    { 2, { 0xC5, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC5, 0x95, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC4, 0x83, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC4, 0xBA, 0x00 } },
+    { 2, { 0xC4, 0x87, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC4, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC4, 0x99, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC4, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC4, 0x8F, 0x00 } },
+    { 2, { 0xC4, 0x91, 0x00 } },
+    { 2, { 0xC5, 0x84, 0x00 } },
+    { 2, { 0xC5, 0x88, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC5, 0x91, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC5, 0x99, 0x00 } },
+    { 2, { 0xC5, 0xAF, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC5, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC3, 0xBD, 0x00 } },
+    { 2, { 0xC5, 0xA3, 0x00 } },
+    { 2, { 0xCB, 0x99, 0x00 } },
+};
+
+static const unsigned char ISO_8859_2_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar ISO_8859_5_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xD0, 0x81, 0x00 } },
+    { 2, { 0xD0, 0x82, 0x00 } },
+    { 2, { 0xD0, 0x83, 0x00 } },
+    { 2, { 0xD0, 0x84, 0x00 } },
+    { 2, { 0xD0, 0x85, 0x00 } },
+    { 2, { 0xD0, 0x86, 0x00 } },
+    { 2, { 0xD0, 0x87, 0x00 } },
+    { 2, { 0xD0, 0x88, 0x00 } },
+    { 2, { 0xD0, 0x89, 0x00 } },
+    { 2, { 0xD0, 0x8A, 0x00 } },
+    { 2, { 0xD0, 0x8B, 0x00 } },
+    { 2, { 0xD0, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xD0, 0x8E, 0x00 } },
+    { 2, { 0xD0, 0x8F, 0x00 } },
+    { 2, { 0xD0, 0x90, 0x00 } },
+    { 2, { 0xD0, 0x91, 0x00 } },
+    { 2, { 0xD0, 0x92, 0x00 } },
+    { 2, { 0xD0, 0x93, 0x00 } },
+    { 2, { 0xD0, 0x94, 0x00 } },
+    { 2, { 0xD0, 0x95, 0x00 } },
+    { 2, { 0xD0, 0x96, 0x00 } },
+    { 2, { 0xD0, 0x97, 0x00 } },
+    { 2, { 0xD0, 0x98, 0x00 } },
+    { 2, { 0xD0, 0x99, 0x00 } },
+    { 2, { 0xD0, 0x9A, 0x00 } },
+    { 2, { 0xD0, 0x9B, 0x00 } },
+    { 2, { 0xD0, 0x9C, 0x00 } },
+    { 2, { 0xD0, 0x9D, 0x00 } },
+    { 2, { 0xD0, 0x9E, 0x00 } },
+    { 2, { 0xD0, 0x9F, 0x00 } },
+    { 2, { 0xD0, 0xA0, 0x00 } },
+    { 2, { 0xD0, 0xA1, 0x00 } },
+    { 2, { 0xD0, 0xA2, 0x00 } },
+    { 2, { 0xD0, 0xA3, 0x00 } },
+    { 2, { 0xD0, 0xA4, 0x00 } },
+    { 2, { 0xD0, 0xA5, 0x00 } },
+    { 2, { 0xD0, 0xA6, 0x00 } },
+    { 2, { 0xD0, 0xA7, 0x00 } },
+    { 2, { 0xD0, 0xA8, 0x00 } },
+    { 2, { 0xD0, 0xA9, 0x00 } },
+    { 2, { 0xD0, 0xAA, 0x00 } },
+    { 2, { 0xD0, 0xAB, 0x00 } },
+    { 2, { 0xD0, 0xAC, 0x00 } },
+    { 2, { 0xD0, 0xAD, 0x00 } },
+    { 2, { 0xD0, 0xAE, 0x00 } },
+    { 2, { 0xD0, 0xAF, 0x00 } },
+    { 2, { 0xD0, 0xB0, 0x00 } },
+    { 2, { 0xD0, 0xB1, 0x00 } },
+    { 2, { 0xD0, 0xB2, 0x00 } },
+    { 2, { 0xD0, 0xB3, 0x00 } },
+    { 2, { 0xD0, 0xB4, 0x00 } },
+    { 2, { 0xD0, 0xB5, 0x00 } },
+    { 2, { 0xD0, 0xB6, 0x00 } },
+    { 2, { 0xD0, 0xB7, 0x00 } },
+    { 2, { 0xD0, 0xB8, 0x00 } },
+    { 2, { 0xD0, 0xB9, 0x00 } },
+    { 2, { 0xD0, 0xBA, 0x00 } },
+    { 2, { 0xD0, 0xBB, 0x00 } },
+    { 2, { 0xD0, 0xBC, 0x00 } },
+    { 2, { 0xD0, 0xBD, 0x00 } },
+    { 2, { 0xD0, 0xBE, 0x00 } },
+    { 2, { 0xD0, 0xBF, 0x00 } },
+    { 2, { 0xD1, 0x80, 0x00 } },
+    { 2, { 0xD1, 0x81, 0x00 } },
+    { 2, { 0xD1, 0x82, 0x00 } },
+    { 2, { 0xD1, 0x83, 0x00 } },
+    { 2, { 0xD1, 0x84, 0x00 } },
+    { 2, { 0xD1, 0x85, 0x00 } },
+    { 2, { 0xD1, 0x86, 0x00 } },
+    { 2, { 0xD1, 0x87, 0x00 } },
+    { 2, { 0xD1, 0x88, 0x00 } },
+    { 2, { 0xD1, 0x89, 0x00 } },
+    { 2, { 0xD1, 0x8A, 0x00 } },
+    { 2, { 0xD1, 0x8B, 0x00 } },
+    { 2, { 0xD1, 0x8C, 0x00 } },
+    { 2, { 0xD1, 0x8D, 0x00 } },
+    { 2, { 0xD1, 0x8E, 0x00 } },
+    { 2, { 0xD1, 0x8F, 0x00 } },
+    { 3, { 0xE2, 0x84, 0x96 } },
+    { 2, { 0xD1, 0x91, 0x00 } },
+    { 2, { 0xD1, 0x92, 0x00 } },
+    { 2, { 0xD1, 0x93, 0x00 } },
+    { 2, { 0xD1, 0x94, 0x00 } },
+    { 2, { 0xD1, 0x95, 0x00 } },
+    { 2, { 0xD1, 0x96, 0x00 } },
+    { 2, { 0xD1, 0x97, 0x00 } },
+    { 2, { 0xD1, 0x98, 0x00 } },
+    { 2, { 0xD1, 0x99, 0x00 } },
+    { 2, { 0xD1, 0x9A, 0x00 } },
+    { 2, { 0xD1, 0x9B, 0x00 } },
+    { 2, { 0xD1, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xD1, 0x9E, 0x00 } },
+    { 2, { 0xD1, 0x9F, 0x00 } },
+};
+
+static const unsigned char ISO_8859_5_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar ISO_8859_6_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD8, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD8, 0x9B, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD8, 0x9F, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD8, 0xA1, 0x00 } },
+    { 2, { 0xD8, 0xA2, 0x00 } },
+    { 2, { 0xD8, 0xA3, 0x00 } },
+    { 2, { 0xD8, 0xA4, 0x00 } },
+    { 2, { 0xD8, 0xA5, 0x00 } },
+    { 2, { 0xD8, 0xA6, 0x00 } },
+    { 2, { 0xD8, 0xA7, 0x00 } },
+    { 2, { 0xD8, 0xA8, 0x00 } },
+    { 2, { 0xD8, 0xA9, 0x00 } },
+    { 2, { 0xD8, 0xAA, 0x00 } },
+    { 2, { 0xD8, 0xAB, 0x00 } },
+    { 2, { 0xD8, 0xAC, 0x00 } },
+    { 2, { 0xD8, 0xAD, 0x00 } },
+    { 2, { 0xD8, 0xAE, 0x00 } },
+    { 2, { 0xD8, 0xAF, 0x00 } },
+    { 2, { 0xD8, 0xB0, 0x00 } },
+    { 2, { 0xD8, 0xB1, 0x00 } },
+    { 2, { 0xD8, 0xB2, 0x00 } },
+    { 2, { 0xD8, 0xB3, 0x00 } },
+    { 2, { 0xD8, 0xB4, 0x00 } },
+    { 2, { 0xD8, 0xB5, 0x00 } },
+    { 2, { 0xD8, 0xB6, 0x00 } },
+    { 2, { 0xD8, 0xB7, 0x00 } },
+    { 2, { 0xD8, 0xB8, 0x00 } },
+    { 2, { 0xD8, 0xB9, 0x00 } },
+    { 2, { 0xD8, 0xBA, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD9, 0x80, 0x00 } },
+    { 2, { 0xD9, 0x81, 0x00 } },
+    { 2, { 0xD9, 0x82, 0x00 } },
+    { 2, { 0xD9, 0x83, 0x00 } },
+    { 2, { 0xD9, 0x84, 0x00 } },
+    { 2, { 0xD9, 0x85, 0x00 } },
+    { 2, { 0xD9, 0x86, 0x00 } },
+    { 2, { 0xD9, 0x87, 0x00 } },
+    { 2, { 0xD9, 0x88, 0x00 } },
+    { 2, { 0xD9, 0x89, 0x00 } },
+    { 2, { 0xD9, 0x8A, 0x00 } },
+    { 2, { 0xD9, 0x8B, 0x00 } },
+    { 2, { 0xD9, 0x8C, 0x00 } },
+    { 2, { 0xD9, 0x8D, 0x00 } },
+    { 2, { 0xD9, 0x8E, 0x00 } },
+    { 2, { 0xD9, 0x8F, 0x00 } },
+    { 2, { 0xD9, 0x90, 0x00 } },
+    { 2, { 0xD9, 0x91, 0x00 } },
+    { 2, { 0xD9, 0x92, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char ISO_8859_6_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEE, 0xCF, 0xFF, 0x77,
+    0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0xFF,
+};
+
+static const SbcsChar ISO_8859_7_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 3, { 0xE2, 0x82, 0xAF } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xCD, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x95 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xCE, 0x84, 0x00 } },
+    { 2, { 0xCE, 0x85, 0x00 } },
+    { 2, { 0xCE, 0x86, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xCE, 0x88, 0x00 } },
+    { 2, { 0xCE, 0x89, 0x00 } },
+    { 2, { 0xCE, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xCE, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xCE, 0x8E, 0x00 } },
+    { 2, { 0xCE, 0x8F, 0x00 } },
+    { 2, { 0xCE, 0x90, 0x00 } },
+    { 2, { 0xCE, 0x91, 0x00 } },
+    { 2, { 0xCE, 0x92, 0x00 } },
+    { 2, { 0xCE, 0x93, 0x00 } },
+    { 2, { 0xCE, 0x94, 0x00 } },
+    { 2, { 0xCE, 0x95, 0x00 } },
+    { 2, { 0xCE, 0x96, 0x00 } },
+    { 2, { 0xCE, 0x97, 0x00 } },
+    { 2, { 0xCE, 0x98, 0x00 } },
+    { 2, { 0xCE, 0x99, 0x00 } },
+    { 2, { 0xCE, 0x9A, 0x00 } },
+    { 2, { 0xCE, 0x9B, 0x00 } },
+    { 2, { 0xCE, 0x9C, 0x00 } },
+    { 2, { 0xCE, 0x9D, 0x00 } },
+    { 2, { 0xCE, 0x9E, 0x00 } },
+    { 2, { 0xCE, 0x9F, 0x00 } },
+    { 2, { 0xCE, 0xA0, 0x00 } },
+    { 2, { 0xCE, 0xA1, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xCE, 0xA3, 0x00 } },
+    { 2, { 0xCE, 0xA4, 0x00 } },
+    { 2, { 0xCE, 0xA5, 0x00 } },
+    { 2, { 0xCE, 0xA6, 0x00 } },
+    { 2, { 0xCE, 0xA7, 0x00 } },
+    { 2, { 0xCE, 0xA8, 0x00 } },
+    { 2, { 0xCE, 0xA9, 0x00 } },
+    { 2, { 0xCE, 0xAA, 0x00 } },
+    { 2, { 0xCE, 0xAB, 0x00 } },
+    { 2, { 0xCE, 0xAC, 0x00 } },
+    { 2, { 0xCE, 0xAD, 0x00 } },
+    { 2, { 0xCE, 0xAE, 0x00 } },
+    { 2, { 0xCE, 0xAF, 0x00 } },
+    { 2, { 0xCE, 0xB0, 0x00 } },
+    { 2, { 0xCE, 0xB1, 0x00 } },
+    { 2, { 0xCE, 0xB2, 0x00 } },
+    { 2, { 0xCE, 0xB3, 0x00 } },
+    { 2, { 0xCE, 0xB4, 0x00 } },
+    { 2, { 0xCE, 0xB5, 0x00 } },
+    { 2, { 0xCE, 0xB6, 0x00 } },
+    { 2, { 0xCE, 0xB7, 0x00 } },
+    { 2, { 0xCE, 0xB8, 0x00 } },
+    { 2, { 0xCE, 0xB9, 0x00 } },
+    { 2, { 0xCE, 0xBA, 0x00 } },
+    { 2, { 0xCE, 0xBB, 0x00 } },
+    { 2, { 0xCE, 0xBC, 0x00 } },
+    { 2, { 0xCE, 0xBD, 0x00 } },
+    { 2, { 0xCE, 0xBE, 0x00 } },
+    { 2, { 0xCE, 0xBF, 0x00 } },
+    { 2, { 0xCF, 0x80, 0x00 } },
+    { 2, { 0xCF, 0x81, 0x00 } },
+    { 2, { 0xCF, 0x82, 0x00 } },
+    { 2, { 0xCF, 0x83, 0x00 } },
+    { 2, { 0xCF, 0x84, 0x00 } },
+    { 2, { 0xCF, 0x85, 0x00 } },
+    { 2, { 0xCF, 0x86, 0x00 } },
+    { 2, { 0xCF, 0x87, 0x00 } },
+    { 2, { 0xCF, 0x88, 0x00 } },
+    { 2, { 0xCF, 0x89, 0x00 } },
+    { 2, { 0xCF, 0x8A, 0x00 } },
+    { 2, { 0xCF, 0x8B, 0x00 } },
+    { 2, { 0xCF, 0x8C, 0x00 } },
+    { 2, { 0xCF, 0x8D, 0x00 } },
+    { 2, { 0xCF, 0x8E, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char ISO_8859_7_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
+};
+
+static const SbcsChar ISO_8859_8_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x97 } },
+    { 2, { 0xD7, 0x90, 0x00 } },
+    { 2, { 0xD7, 0x91, 0x00 } },
+    { 2, { 0xD7, 0x92, 0x00 } },
+    { 2, { 0xD7, 0x93, 0x00 } },
+    { 2, { 0xD7, 0x94, 0x00 } },
+    { 2, { 0xD7, 0x95, 0x00 } },
+    { 2, { 0xD7, 0x96, 0x00 } },
+    { 2, { 0xD7, 0x97, 0x00 } },
+    { 2, { 0xD7, 0x98, 0x00 } },
+    { 2, { 0xD7, 0x99, 0x00 } },
+    { 2, { 0xD7, 0x9A, 0x00 } },
+    { 2, { 0xD7, 0x9B, 0x00 } },
+    { 2, { 0xD7, 0x9C, 0x00 } },
+    { 2, { 0xD7, 0x9D, 0x00 } },
+    { 2, { 0xD7, 0x9E, 0x00 } },
+    { 2, { 0xD7, 0x9F, 0x00 } },
+    { 2, { 0xD7, 0xA0, 0x00 } },
+    { 2, { 0xD7, 0xA1, 0x00 } },
+    { 2, { 0xD7, 0xA2, 0x00 } },
+    { 2, { 0xD7, 0xA3, 0x00 } },
+    { 2, { 0xD7, 0xA4, 0x00 } },
+    { 2, { 0xD7, 0xA5, 0x00 } },
+    { 2, { 0xD7, 0xA6, 0x00 } },
+    { 2, { 0xD7, 0xA7, 0x00 } },
+    { 2, { 0xD7, 0xA8, 0x00 } },
+    { 2, { 0xD7, 0xA9, 0x00 } },
+    { 2, { 0xD7, 0xAA, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x8E } },
+    { 3, { 0xE2, 0x80, 0x8F } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char ISO_8859_8_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x98,
+};
+
+static const SbcsChar ISO_8859_8_I_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x97 } },
+    { 2, { 0xD7, 0x90, 0x00 } },
+    { 2, { 0xD7, 0x91, 0x00 } },
+    { 2, { 0xD7, 0x92, 0x00 } },
+    { 2, { 0xD7, 0x93, 0x00 } },
+    { 2, { 0xD7, 0x94, 0x00 } },
+    { 2, { 0xD7, 0x95, 0x00 } },
+    { 2, { 0xD7, 0x96, 0x00 } },
+    { 2, { 0xD7, 0x97, 0x00 } },
+    { 2, { 0xD7, 0x98, 0x00 } },
+    { 2, { 0xD7, 0x99, 0x00 } },
+    { 2, { 0xD7, 0x9A, 0x00 } },
+    { 2, { 0xD7, 0x9B, 0x00 } },
+    { 2, { 0xD7, 0x9C, 0x00 } },
+    { 2, { 0xD7, 0x9D, 0x00 } },
+    { 2, { 0xD7, 0x9E, 0x00 } },
+    { 2, { 0xD7, 0x9F, 0x00 } },
+    { 2, { 0xD7, 0xA0, 0x00 } },
+    { 2, { 0xD7, 0xA1, 0x00 } },
+    { 2, { 0xD7, 0xA2, 0x00 } },
+    { 2, { 0xD7, 0xA3, 0x00 } },
+    { 2, { 0xD7, 0xA4, 0x00 } },
+    { 2, { 0xD7, 0xA5, 0x00 } },
+    { 2, { 0xD7, 0xA6, 0x00 } },
+    { 2, { 0xD7, 0xA7, 0x00 } },
+    { 2, { 0xD7, 0xA8, 0x00 } },
+    { 2, { 0xD7, 0xA9, 0x00 } },
+    { 2, { 0xD7, 0xAA, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x8E } },
+    { 3, { 0xE2, 0x80, 0x8F } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char ISO_8859_8_I_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x98,
+};
+
+static const SbcsChar ISO_8859_9_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xC2, 0x80, 0x00 } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 2, { 0xC2, 0x82, 0x00 } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 2, { 0xC2, 0x84, 0x00 } },
+    { 2, { 0xC2, 0x85, 0x00 } },
+    { 2, { 0xC2, 0x86, 0x00 } },
+    { 2, { 0xC2, 0x87, 0x00 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 2, { 0xC2, 0x89, 0x00 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0x8B, 0x00 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x94, 0x00 } },
+    { 2, { 0xC2, 0x95, 0x00 } },
+    { 2, { 0xC2, 0x96, 0x00 } },
+    { 2, { 0xC2, 0x97, 0x00 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 2, { 0xC2, 0x99, 0x00 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 2, { 0xC2, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC2, 0xA1, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC2, 0xAA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xBF, 0x00 } },
+    { 2, { 0xC3, 0x80, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x83, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC3, 0x85, 0x00 } },
+    { 2, { 0xC3, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x88, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC3, 0x8A, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC3, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC3, 0x8F, 0x00 } },
+    { 2, { 0xC4, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x91, 0x00 } },
+    { 2, { 0xC3, 0x92, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x95, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC3, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x99, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC4, 0xB0, 0x00 } },
+    { 2, { 0xC5, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xA0, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0xA3, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC3, 0xA5, 0x00 } },
+    { 2, { 0xC3, 0xA6, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC3, 0xA8, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0xAA, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC3, 0xAC, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0xAF, 0x00 } },
+    { 2, { 0xC4, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xB2, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC3, 0xB5, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC3, 0xB8, 0x00 } },
+    { 2, { 0xC3, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC3, 0xBB, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC4, 0xB1, 0x00 } },
+    { 2, { 0xC5, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xBF, 0x00 } },
+};
+
+static const unsigned char ISO_8859_9_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar windows_1250_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC2, 0x83, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xC5, 0xA0, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC5, 0x9A, 0x00 } },
+    { 2, { 0xC5, 0xA4, 0x00 } },
+    { 2, { 0xC5, 0xBD, 0x00 } },
+    { 2, { 0xC5, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xC5, 0xA1, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC5, 0x9B, 0x00 } },
+    { 2, { 0xC5, 0xA5, 0x00 } },
+    { 2, { 0xC5, 0xBE, 0x00 } },
+    { 2, { 0xC5, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xCB, 0x87, 0x00 } },
+    { 2, { 0xCB, 0x98, 0x00 } },
+    { 2, { 0xC5, 0x81, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC4, 0x84, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC5, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC5, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xCB, 0x9B, 0x00 } },
+    { 2, { 0xC5, 0x82, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC4, 0x85, 0x00 } },
+    { 2, { 0xC5, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC4, 0xBD, 0x00 } },
+    { 2, { 0xCB, 0x9D, 0x00 } },
+    { 2, { 0xC4, 0xBE, 0x00 } },
+    { 2, { 0xC5, 0xBC, 0x00 } },
+    { 2, { 0xC5, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC4, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC4, 0xB9, 0x00 } },
+    { 2, { 0xC4, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC4, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC4, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC4, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC4, 0x8E, 0x00 } },
+    { 2, { 0xC4, 0x90, 0x00 } },
+    { 2, { 0xC5, 0x83, 0x00 } },
+    { 2, { 0xC5, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC5, 0x90, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC5, 0x98, 0x00 } },
+    { 2, { 0xC5, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC5, 0xB0, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC3, 0x9D, 0x00 } },
+    { 2, { 0xC5, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC5, 0x95, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC4, 0x83, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC4, 0xBA, 0x00 } },
+    { 2, { 0xC4, 0x87, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC4, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC4, 0x99, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC4, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC4, 0x8F, 0x00 } },
+    { 2, { 0xC4, 0x91, 0x00 } },
+    { 2, { 0xC5, 0x84, 0x00 } },
+    { 2, { 0xC5, 0x88, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC5, 0x91, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC5, 0x99, 0x00 } },
+    { 2, { 0xC5, 0xAF, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC5, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC3, 0xBD, 0x00 } },
+    { 2, { 0xC5, 0xA3, 0x00 } },
+    { 2, { 0xCB, 0x99, 0x00 } },
+};
+
+static const unsigned char windows_1250_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar windows_1251_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 2, { 0xD0, 0x82, 0x00 } },
+    { 2, { 0xD0, 0x83, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xD1, 0x93, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xD0, 0x89, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xD0, 0x8A, 0x00 } },
+    { 2, { 0xD0, 0x8C, 0x00 } },
+    { 2, { 0xD0, 0x8B, 0x00 } },
+    { 2, { 0xD0, 0x8F, 0x00 } },
+    { 2, { 0xD1, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xD1, 0x99, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xD1, 0x9A, 0x00 } },
+    { 2, { 0xD1, 0x9C, 0x00 } },
+    { 2, { 0xD1, 0x9B, 0x00 } },
+    { 2, { 0xD1, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xD0, 0x8E, 0x00 } },
+    { 2, { 0xD1, 0x9E, 0x00 } },
+    { 2, { 0xD0, 0x88, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xD2, 0x90, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xD0, 0x81, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xD0, 0x84, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xD0, 0x87, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xD0, 0x86, 0x00 } },
+    { 2, { 0xD1, 0x96, 0x00 } },
+    { 2, { 0xD2, 0x91, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xD1, 0x91, 0x00 } },
+    { 3, { 0xE2, 0x84, 0x96 } },
+    { 2, { 0xD1, 0x94, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xD1, 0x98, 0x00 } },
+    { 2, { 0xD0, 0x85, 0x00 } },
+    { 2, { 0xD1, 0x95, 0x00 } },
+    { 2, { 0xD1, 0x97, 0x00 } },
+    { 2, { 0xD0, 0x90, 0x00 } },
+    { 2, { 0xD0, 0x91, 0x00 } },
+    { 2, { 0xD0, 0x92, 0x00 } },
+    { 2, { 0xD0, 0x93, 0x00 } },
+    { 2, { 0xD0, 0x94, 0x00 } },
+    { 2, { 0xD0, 0x95, 0x00 } },
+    { 2, { 0xD0, 0x96, 0x00 } },
+    { 2, { 0xD0, 0x97, 0x00 } },
+    { 2, { 0xD0, 0x98, 0x00 } },
+    { 2, { 0xD0, 0x99, 0x00 } },
+    { 2, { 0xD0, 0x9A, 0x00 } },
+    { 2, { 0xD0, 0x9B, 0x00 } },
+    { 2, { 0xD0, 0x9C, 0x00 } },
+    { 2, { 0xD0, 0x9D, 0x00 } },
+    { 2, { 0xD0, 0x9E, 0x00 } },
+    { 2, { 0xD0, 0x9F, 0x00 } },
+    { 2, { 0xD0, 0xA0, 0x00 } },
+    { 2, { 0xD0, 0xA1, 0x00 } },
+    { 2, { 0xD0, 0xA2, 0x00 } },
+    { 2, { 0xD0, 0xA3, 0x00 } },
+    { 2, { 0xD0, 0xA4, 0x00 } },
+    { 2, { 0xD0, 0xA5, 0x00 } },
+    { 2, { 0xD0, 0xA6, 0x00 } },
+    { 2, { 0xD0, 0xA7, 0x00 } },
+    { 2, { 0xD0, 0xA8, 0x00 } },
+    { 2, { 0xD0, 0xA9, 0x00 } },
+    { 2, { 0xD0, 0xAA, 0x00 } },
+    { 2, { 0xD0, 0xAB, 0x00 } },
+    { 2, { 0xD0, 0xAC, 0x00 } },
+    { 2, { 0xD0, 0xAD, 0x00 } },
+    { 2, { 0xD0, 0xAE, 0x00 } },
+    { 2, { 0xD0, 0xAF, 0x00 } },
+    { 2, { 0xD0, 0xB0, 0x00 } },
+    { 2, { 0xD0, 0xB1, 0x00 } },
+    { 2, { 0xD0, 0xB2, 0x00 } },
+    { 2, { 0xD0, 0xB3, 0x00 } },
+    { 2, { 0xD0, 0xB4, 0x00 } },
+    { 2, { 0xD0, 0xB5, 0x00 } },
+    { 2, { 0xD0, 0xB6, 0x00 } },
+    { 2, { 0xD0, 0xB7, 0x00 } },
+    { 2, { 0xD0, 0xB8, 0x00 } },
+    { 2, { 0xD0, 0xB9, 0x00 } },
+    { 2, { 0xD0, 0xBA, 0x00 } },
+    { 2, { 0xD0, 0xBB, 0x00 } },
+    { 2, { 0xD0, 0xBC, 0x00 } },
+    { 2, { 0xD0, 0xBD, 0x00 } },
+    { 2, { 0xD0, 0xBE, 0x00 } },
+    { 2, { 0xD0, 0xBF, 0x00 } },
+    { 2, { 0xD1, 0x80, 0x00 } },
+    { 2, { 0xD1, 0x81, 0x00 } },
+    { 2, { 0xD1, 0x82, 0x00 } },
+    { 2, { 0xD1, 0x83, 0x00 } },
+    { 2, { 0xD1, 0x84, 0x00 } },
+    { 2, { 0xD1, 0x85, 0x00 } },
+    { 2, { 0xD1, 0x86, 0x00 } },
+    { 2, { 0xD1, 0x87, 0x00 } },
+    { 2, { 0xD1, 0x88, 0x00 } },
+    { 2, { 0xD1, 0x89, 0x00 } },
+    { 2, { 0xD1, 0x8A, 0x00 } },
+    { 2, { 0xD1, 0x8B, 0x00 } },
+    { 2, { 0xD1, 0x8C, 0x00 } },
+    { 2, { 0xD1, 0x8D, 0x00 } },
+    { 2, { 0xD1, 0x8E, 0x00 } },
+    { 2, { 0xD1, 0x8F, 0x00 } },
+};
+
+static const unsigned char windows_1251_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar windows_1252_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC6, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xCB, 0x86, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xC5, 0xA0, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC5, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC5, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xCB, 0x9C, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xC5, 0xA1, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC5, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC5, 0xBE, 0x00 } },
+    { 2, { 0xC5, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC2, 0xA1, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC2, 0xAA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xBF, 0x00 } },
+    { 2, { 0xC3, 0x80, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x83, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC3, 0x85, 0x00 } },
+    { 2, { 0xC3, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x88, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC3, 0x8A, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC3, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC3, 0x8F, 0x00 } },
+    { 2, { 0xC3, 0x90, 0x00 } },
+    { 2, { 0xC3, 0x91, 0x00 } },
+    { 2, { 0xC3, 0x92, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x95, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC3, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x99, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC3, 0x9D, 0x00 } },
+    { 2, { 0xC3, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xA0, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0xA3, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC3, 0xA5, 0x00 } },
+    { 2, { 0xC3, 0xA6, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC3, 0xA8, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0xAA, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC3, 0xAC, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0xAF, 0x00 } },
+    { 2, { 0xC3, 0xB0, 0x00 } },
+    { 2, { 0xC3, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xB2, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC3, 0xB5, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC3, 0xB8, 0x00 } },
+    { 2, { 0xC3, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC3, 0xBB, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC3, 0xBD, 0x00 } },
+    { 2, { 0xC3, 0xBE, 0x00 } },
+    { 2, { 0xC3, 0xBF, 0x00 } },
+};
+
+static const unsigned char windows_1252_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar windows_1253_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC6, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xC2, 0x88, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xC2, 0x98, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xCE, 0x85, 0x00 } },
+    { 2, { 0xCE, 0x86, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC2, 0xAA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x95 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xCE, 0x84, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xCE, 0x88, 0x00 } },
+    { 2, { 0xCE, 0x89, 0x00 } },
+    { 2, { 0xCE, 0x8A, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xCE, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xCE, 0x8E, 0x00 } },
+    { 2, { 0xCE, 0x8F, 0x00 } },
+    { 2, { 0xCE, 0x90, 0x00 } },
+    { 2, { 0xCE, 0x91, 0x00 } },
+    { 2, { 0xCE, 0x92, 0x00 } },
+    { 2, { 0xCE, 0x93, 0x00 } },
+    { 2, { 0xCE, 0x94, 0x00 } },
+    { 2, { 0xCE, 0x95, 0x00 } },
+    { 2, { 0xCE, 0x96, 0x00 } },
+    { 2, { 0xCE, 0x97, 0x00 } },
+    { 2, { 0xCE, 0x98, 0x00 } },
+    { 2, { 0xCE, 0x99, 0x00 } },
+    { 2, { 0xCE, 0x9A, 0x00 } },
+    { 2, { 0xCE, 0x9B, 0x00 } },
+    { 2, { 0xCE, 0x9C, 0x00 } },
+    { 2, { 0xCE, 0x9D, 0x00 } },
+    { 2, { 0xCE, 0x9E, 0x00 } },
+    { 2, { 0xCE, 0x9F, 0x00 } },
+    { 2, { 0xCE, 0xA0, 0x00 } },
+    { 2, { 0xCE, 0xA1, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xCE, 0xA3, 0x00 } },
+    { 2, { 0xCE, 0xA4, 0x00 } },
+    { 2, { 0xCE, 0xA5, 0x00 } },
+    { 2, { 0xCE, 0xA6, 0x00 } },
+    { 2, { 0xCE, 0xA7, 0x00 } },
+    { 2, { 0xCE, 0xA8, 0x00 } },
+    { 2, { 0xCE, 0xA9, 0x00 } },
+    { 2, { 0xCE, 0xAA, 0x00 } },
+    { 2, { 0xCE, 0xAB, 0x00 } },
+    { 2, { 0xCE, 0xAC, 0x00 } },
+    { 2, { 0xCE, 0xAD, 0x00 } },
+    { 2, { 0xCE, 0xAE, 0x00 } },
+    { 2, { 0xCE, 0xAF, 0x00 } },
+    { 2, { 0xCE, 0xB0, 0x00 } },
+    { 2, { 0xCE, 0xB1, 0x00 } },
+    { 2, { 0xCE, 0xB2, 0x00 } },
+    { 2, { 0xCE, 0xB3, 0x00 } },
+    { 2, { 0xCE, 0xB4, 0x00 } },
+    { 2, { 0xCE, 0xB5, 0x00 } },
+    { 2, { 0xCE, 0xB6, 0x00 } },
+    { 2, { 0xCE, 0xB7, 0x00 } },
+    { 2, { 0xCE, 0xB8, 0x00 } },
+    { 2, { 0xCE, 0xB9, 0x00 } },
+    { 2, { 0xCE, 0xBA, 0x00 } },
+    { 2, { 0xCE, 0xBB, 0x00 } },
+    { 2, { 0xCE, 0xBC, 0x00 } },
+    { 2, { 0xCE, 0xBD, 0x00 } },
+    { 2, { 0xCE, 0xBE, 0x00 } },
+    { 2, { 0xCE, 0xBF, 0x00 } },
+    { 2, { 0xCF, 0x80, 0x00 } },
+    { 2, { 0xCF, 0x81, 0x00 } },
+    { 2, { 0xCF, 0x82, 0x00 } },
+    { 2, { 0xCF, 0x83, 0x00 } },
+    { 2, { 0xCF, 0x84, 0x00 } },
+    { 2, { 0xCF, 0x85, 0x00 } },
+    { 2, { 0xCF, 0x86, 0x00 } },
+    { 2, { 0xCF, 0x87, 0x00 } },
+    { 2, { 0xCF, 0x88, 0x00 } },
+    { 2, { 0xCF, 0x89, 0x00 } },
+    { 2, { 0xCF, 0x8A, 0x00 } },
+    { 2, { 0xCF, 0x8B, 0x00 } },
+    { 2, { 0xCF, 0x8C, 0x00 } },
+    { 2, { 0xCF, 0x8D, 0x00 } },
+    { 2, { 0xCF, 0x8E, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char windows_1253_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
+};
+
+static const SbcsChar windows_1254_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC6, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xCB, 0x86, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xC5, 0xA0, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC5, 0x92, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xCB, 0x9C, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xC5, 0xA1, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC5, 0x93, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC5, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC2, 0xA1, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC2, 0xAA, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC2, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xBF, 0x00 } },
+    { 2, { 0xC3, 0x80, 0x00 } },
+    { 2, { 0xC3, 0x81, 0x00 } },
+    { 2, { 0xC3, 0x82, 0x00 } },
+    { 2, { 0xC3, 0x83, 0x00 } },
+    { 2, { 0xC3, 0x84, 0x00 } },
+    { 2, { 0xC3, 0x85, 0x00 } },
+    { 2, { 0xC3, 0x86, 0x00 } },
+    { 2, { 0xC3, 0x87, 0x00 } },
+    { 2, { 0xC3, 0x88, 0x00 } },
+    { 2, { 0xC3, 0x89, 0x00 } },
+    { 2, { 0xC3, 0x8A, 0x00 } },
+    { 2, { 0xC3, 0x8B, 0x00 } },
+    { 2, { 0xC3, 0x8C, 0x00 } },
+    { 2, { 0xC3, 0x8D, 0x00 } },
+    { 2, { 0xC3, 0x8E, 0x00 } },
+    { 2, { 0xC3, 0x8F, 0x00 } },
+    { 2, { 0xC4, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x91, 0x00 } },
+    { 2, { 0xC3, 0x92, 0x00 } },
+    { 2, { 0xC3, 0x93, 0x00 } },
+    { 2, { 0xC3, 0x94, 0x00 } },
+    { 2, { 0xC3, 0x95, 0x00 } },
+    { 2, { 0xC3, 0x96, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC3, 0x98, 0x00 } },
+    { 2, { 0xC3, 0x99, 0x00 } },
+    { 2, { 0xC3, 0x9A, 0x00 } },
+    { 2, { 0xC3, 0x9B, 0x00 } },
+    { 2, { 0xC3, 0x9C, 0x00 } },
+    { 2, { 0xC4, 0xB0, 0x00 } },
+    { 2, { 0xC5, 0x9E, 0x00 } },
+    { 2, { 0xC3, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xA0, 0x00 } },
+    { 2, { 0xC3, 0xA1, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xC3, 0xA3, 0x00 } },
+    { 2, { 0xC3, 0xA4, 0x00 } },
+    { 2, { 0xC3, 0xA5, 0x00 } },
+    { 2, { 0xC3, 0xA6, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC3, 0xA8, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0xAA, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xC3, 0xAC, 0x00 } },
+    { 2, { 0xC3, 0xAD, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0xAF, 0x00 } },
+    { 2, { 0xC4, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xB1, 0x00 } },
+    { 2, { 0xC3, 0xB2, 0x00 } },
+    { 2, { 0xC3, 0xB3, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xC3, 0xB5, 0x00 } },
+    { 2, { 0xC3, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC3, 0xB8, 0x00 } },
+    { 2, { 0xC3, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xBA, 0x00 } },
+    { 2, { 0xC3, 0xBB, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 2, { 0xC4, 0xB1, 0x00 } },
+    { 2, { 0xC5, 0x9F, 0x00 } },
+    { 2, { 0xC3, 0xBF, 0x00 } },
+};
+
+static const unsigned char windows_1254_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar windows_1255_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xC2, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC6, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xCB, 0x86, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xC2, 0x8A, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC2, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0x8D, 0x00 } },
+    { 2, { 0xC2, 0x8E, 0x00 } },
+    { 2, { 0xC2, 0x8F, 0x00 } },
+    { 2, { 0xC2, 0x90, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xCB, 0x9C, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xC2, 0x9A, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC2, 0x9C, 0x00 } },
+    { 2, { 0xC2, 0x9D, 0x00 } },
+    { 2, { 0xC2, 0x9E, 0x00 } },
+    { 2, { 0xC2, 0x9F, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xC2, 0xA1, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAA } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xBF, 0x00 } },
+    { 2, { 0xD6, 0xB0, 0x00 } },
+    { 2, { 0xD6, 0xB1, 0x00 } },
+    { 2, { 0xD6, 0xB2, 0x00 } },
+    { 2, { 0xD6, 0xB3, 0x00 } },
+    { 2, { 0xD6, 0xB4, 0x00 } },
+    { 2, { 0xD6, 0xB5, 0x00 } },
+    { 2, { 0xD6, 0xB6, 0x00 } },
+    { 2, { 0xD6, 0xB7, 0x00 } },
+    { 2, { 0xD6, 0xB8, 0x00 } },
+    { 2, { 0xD6, 0xB9, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD6, 0xBB, 0x00 } },
+    { 2, { 0xD6, 0xBC, 0x00 } },
+    { 2, { 0xD6, 0xBD, 0x00 } },
+    { 2, { 0xD6, 0xBE, 0x00 } },
+    { 2, { 0xD6, 0xBF, 0x00 } },
+    { 2, { 0xD7, 0x80, 0x00 } },
+    { 2, { 0xD7, 0x81, 0x00 } },
+    { 2, { 0xD7, 0x82, 0x00 } },
+    { 2, { 0xD7, 0x83, 0x00 } },
+    { 2, { 0xD7, 0xB0, 0x00 } },
+    { 2, { 0xD7, 0xB1, 0x00 } },
+    { 2, { 0xD7, 0xB2, 0x00 } },
+    { 2, { 0xD7, 0xB3, 0x00 } },
+    { 2, { 0xD7, 0xB4, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 2, { 0xD7, 0x90, 0x00 } },
+    { 2, { 0xD7, 0x91, 0x00 } },
+    { 2, { 0xD7, 0x92, 0x00 } },
+    { 2, { 0xD7, 0x93, 0x00 } },
+    { 2, { 0xD7, 0x94, 0x00 } },
+    { 2, { 0xD7, 0x95, 0x00 } },
+    { 2, { 0xD7, 0x96, 0x00 } },
+    { 2, { 0xD7, 0x97, 0x00 } },
+    { 2, { 0xD7, 0x98, 0x00 } },
+    { 2, { 0xD7, 0x99, 0x00 } },
+    { 2, { 0xD7, 0x9A, 0x00 } },
+    { 2, { 0xD7, 0x9B, 0x00 } },
+    { 2, { 0xD7, 0x9C, 0x00 } },
+    { 2, { 0xD7, 0x9D, 0x00 } },
+    { 2, { 0xD7, 0x9E, 0x00 } },
+    { 2, { 0xD7, 0x9F, 0x00 } },
+    { 2, { 0xD7, 0xA0, 0x00 } },
+    { 2, { 0xD7, 0xA1, 0x00 } },
+    { 2, { 0xD7, 0xA2, 0x00 } },
+    { 2, { 0xD7, 0xA3, 0x00 } },
+    { 2, { 0xD7, 0xA4, 0x00 } },
+    { 2, { 0xD7, 0xA5, 0x00 } },
+    { 2, { 0xD7, 0xA6, 0x00 } },
+    { 2, { 0xD7, 0xA7, 0x00 } },
+    { 2, { 0xD7, 0xA8, 0x00 } },
+    { 2, { 0xD7, 0xA9, 0x00 } },
+    { 2, { 0xD7, 0xAA, 0x00 } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+    { 3, { 0xE2, 0x80, 0x8E } },
+    { 3, { 0xE2, 0x80, 0x8F } },
+    { 3, { 0xEF, 0xBF, 0xBD } },
+};
+
+static const unsigned char windows_1255_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x98,
+};
+
+static const SbcsChar windows_1256_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x82, 0xAC } },
+    { 2, { 0xD9, 0xBE, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9A } },
+    { 2, { 0xC6, 0x92, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x9E } },
+    { 3, { 0xE2, 0x80, 0xA6 } },
+    { 3, { 0xE2, 0x80, 0xA0 } },
+    { 3, { 0xE2, 0x80, 0xA1 } },
+    { 2, { 0xCB, 0x86, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB0 } },
+    { 2, { 0xD9, 0xB9, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xB9 } },
+    { 2, { 0xC5, 0x92, 0x00 } },
+    { 2, { 0xDA, 0x86, 0x00 } },
+    { 2, { 0xDA, 0x98, 0x00 } },
+    { 2, { 0xDA, 0x88, 0x00 } },
+    { 2, { 0xDA, 0xAF, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x98 } },
+    { 3, { 0xE2, 0x80, 0x99 } },
+    { 3, { 0xE2, 0x80, 0x9C } },
+    { 3, { 0xE2, 0x80, 0x9D } },
+    { 3, { 0xE2, 0x80, 0xA2 } },
+    { 3, { 0xE2, 0x80, 0x93 } },
+    { 3, { 0xE2, 0x80, 0x94 } },
+    { 2, { 0xDA, 0xA9, 0x00 } },
+    { 3, { 0xE2, 0x84, 0xA2 } },
+    { 2, { 0xDA, 0x91, 0x00 } },
+    { 3, { 0xE2, 0x80, 0xBA } },
+    { 2, { 0xC5, 0x93, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x8C } },
+    { 3, { 0xE2, 0x80, 0x8D } },
+    { 2, { 0xDA, 0xBA, 0x00 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 2, { 0xD8, 0x8C, 0x00 } },
+    { 2, { 0xC2, 0xA2, 0x00 } },
+    { 2, { 0xC2, 0xA3, 0x00 } },
+    { 2, { 0xC2, 0xA4, 0x00 } },
+    { 2, { 0xC2, 0xA5, 0x00 } },
+    { 2, { 0xC2, 0xA6, 0x00 } },
+    { 2, { 0xC2, 0xA7, 0x00 } },
+    { 2, { 0xC2, 0xA8, 0x00 } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xDA, 0xBE, 0x00 } },
+    { 2, { 0xC2, 0xAB, 0x00 } },
+    { 2, { 0xC2, 0xAC, 0x00 } },
+    { 2, { 0xC2, 0xAD, 0x00 } },
+    { 2, { 0xC2, 0xAE, 0x00 } },
+    { 2, { 0xC2, 0xAF, 0x00 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB1, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB3, 0x00 } },
+    { 2, { 0xC2, 0xB4, 0x00 } },
+    { 2, { 0xC2, 0xB5, 0x00 } },
+    { 2, { 0xC2, 0xB6, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC2, 0xB8, 0x00 } },
+    { 2, { 0xC2, 0xB9, 0x00 } },
+    { 2, { 0xD8, 0x9B, 0x00 } },
+    { 2, { 0xC2, 0xBB, 0x00 } },
+    { 2, { 0xC2, 0xBC, 0x00 } },
+    { 2, { 0xC2, 0xBD, 0x00 } },
+    { 2, { 0xC2, 0xBE, 0x00 } },
+    { 2, { 0xD8, 0x9F, 0x00 } },
+    { 2, { 0xDB, 0x81, 0x00 } },
+    { 2, { 0xD8, 0xA1, 0x00 } },
+    { 2, { 0xD8, 0xA2, 0x00 } },
+    { 2, { 0xD8, 0xA3, 0x00 } },
+    { 2, { 0xD8, 0xA4, 0x00 } },
+    { 2, { 0xD8, 0xA5, 0x00 } },
+    { 2, { 0xD8, 0xA6, 0x00 } },
+    { 2, { 0xD8, 0xA7, 0x00 } },
+    { 2, { 0xD8, 0xA8, 0x00 } },
+    { 2, { 0xD8, 0xA9, 0x00 } },
+    { 2, { 0xD8, 0xAA, 0x00 } },
+    { 2, { 0xD8, 0xAB, 0x00 } },
+    { 2, { 0xD8, 0xAC, 0x00 } },
+    { 2, { 0xD8, 0xAD, 0x00 } },
+    { 2, { 0xD8, 0xAE, 0x00 } },
+    { 2, { 0xD8, 0xAF, 0x00 } },
+    { 2, { 0xD8, 0xB0, 0x00 } },
+    { 2, { 0xD8, 0xB1, 0x00 } },
+    { 2, { 0xD8, 0xB2, 0x00 } },
+    { 2, { 0xD8, 0xB3, 0x00 } },
+    { 2, { 0xD8, 0xB4, 0x00 } },
+    { 2, { 0xD8, 0xB5, 0x00 } },
+    { 2, { 0xD8, 0xB6, 0x00 } },
+    { 2, { 0xC3, 0x97, 0x00 } },
+    { 2, { 0xD8, 0xB7, 0x00 } },
+    { 2, { 0xD8, 0xB8, 0x00 } },
+    { 2, { 0xD8, 0xB9, 0x00 } },
+    { 2, { 0xD8, 0xBA, 0x00 } },
+    { 2, { 0xD9, 0x80, 0x00 } },
+    { 2, { 0xD9, 0x81, 0x00 } },
+    { 2, { 0xD9, 0x82, 0x00 } },
+    { 2, { 0xD9, 0x83, 0x00 } },
+    { 2, { 0xC3, 0xA0, 0x00 } },
+    { 2, { 0xD9, 0x84, 0x00 } },
+    { 2, { 0xC3, 0xA2, 0x00 } },
+    { 2, { 0xD9, 0x85, 0x00 } },
+    { 2, { 0xD9, 0x86, 0x00 } },
+    { 2, { 0xD9, 0x87, 0x00 } },
+    { 2, { 0xD9, 0x88, 0x00 } },
+    { 2, { 0xC3, 0xA7, 0x00 } },
+    { 2, { 0xC3, 0xA8, 0x00 } },
+    { 2, { 0xC3, 0xA9, 0x00 } },
+    { 2, { 0xC3, 0xAA, 0x00 } },
+    { 2, { 0xC3, 0xAB, 0x00 } },
+    { 2, { 0xD9, 0x89, 0x00 } },
+    { 2, { 0xD9, 0x8A, 0x00 } },
+    { 2, { 0xC3, 0xAE, 0x00 } },
+    { 2, { 0xC3, 0xAF, 0x00 } },
+    { 2, { 0xD9, 0x8B, 0x00 } },
+    { 2, { 0xD9, 0x8C, 0x00 } },
+    { 2, { 0xD9, 0x8D, 0x00 } },
+    { 2, { 0xD9, 0x8E, 0x00 } },
+    { 2, { 0xC3, 0xB4, 0x00 } },
+    { 2, { 0xD9, 0x8F, 0x00 } },
+    { 2, { 0xD9, 0x90, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 2, { 0xD9, 0x91, 0x00 } },
+    { 2, { 0xC3, 0xB9, 0x00 } },
+    { 2, { 0xD9, 0x92, 0x00 } },
+    { 2, { 0xC3, 0xBB, 0x00 } },
+    { 2, { 0xC3, 0xBC, 0x00 } },
+    { 3, { 0xE2, 0x80, 0x8E } },
+    { 3, { 0xE2, 0x80, 0x8F } },
+    { 2, { 0xDB, 0x92, 0x00 } },
+};
+
+static const unsigned char windows_1256_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SbcsChar KOI8_R_map[256] =
+{
+    { 1, { 0x00, 0x00, 0x00 } },
+    { 1, { 0x01, 0x00, 0x00 } },
+    { 1, { 0x02, 0x00, 0x00 } },
+    { 1, { 0x03, 0x00, 0x00 } },
+    { 1, { 0x04, 0x00, 0x00 } },
+    { 1, { 0x05, 0x00, 0x00 } },
+    { 1, { 0x06, 0x00, 0x00 } },
+    { 1, { 0x07, 0x00, 0x00 } },
+    { 1, { 0x08, 0x00, 0x00 } },
+    { 1, { 0x09, 0x00, 0x00 } },
+    { 1, { 0x0A, 0x00, 0x00 } },
+    { 1, { 0x0B, 0x00, 0x00 } },
+    { 1, { 0x0C, 0x00, 0x00 } },
+    { 1, { 0x0D, 0x00, 0x00 } },
+    { 1, { 0x0E, 0x00, 0x00 } },
+    { 1, { 0x0F, 0x00, 0x00 } },
+    { 1, { 0x10, 0x00, 0x00 } },
+    { 1, { 0x11, 0x00, 0x00 } },
+    { 1, { 0x12, 0x00, 0x00 } },
+    { 1, { 0x13, 0x00, 0x00 } },
+    { 1, { 0x14, 0x00, 0x00 } },
+    { 1, { 0x15, 0x00, 0x00 } },
+    { 1, { 0x16, 0x00, 0x00 } },
+    { 1, { 0x17, 0x00, 0x00 } },
+    { 1, { 0x18, 0x00, 0x00 } },
+    { 1, { 0x19, 0x00, 0x00 } },
+    { 1, { 0x1A, 0x00, 0x00 } },
+    { 1, { 0x1B, 0x00, 0x00 } },
+    { 1, { 0x1C, 0x00, 0x00 } },
+    { 1, { 0x1D, 0x00, 0x00 } },
+    { 1, { 0x1E, 0x00, 0x00 } },
+    { 1, { 0x1F, 0x00, 0x00 } },
+    { 1, { 0x20, 0x00, 0x00 } },
+    { 1, { 0x21, 0x00, 0x00 } },
+    { 1, { 0x22, 0x00, 0x00 } },
+    { 1, { 0x23, 0x00, 0x00 } },
+    { 1, { 0x24, 0x00, 0x00 } },
+    { 1, { 0x25, 0x00, 0x00 } },
+    { 1, { 0x26, 0x00, 0x00 } },
+    { 1, { 0x27, 0x00, 0x00 } },
+    { 1, { 0x28, 0x00, 0x00 } },
+    { 1, { 0x29, 0x00, 0x00 } },
+    { 1, { 0x2A, 0x00, 0x00 } },
+    { 1, { 0x2B, 0x00, 0x00 } },
+    { 1, { 0x2C, 0x00, 0x00 } },
+    { 1, { 0x2D, 0x00, 0x00 } },
+    { 1, { 0x2E, 0x00, 0x00 } },
+    { 1, { 0x2F, 0x00, 0x00 } },
+    { 1, { 0x30, 0x00, 0x00 } },
+    { 1, { 0x31, 0x00, 0x00 } },
+    { 1, { 0x32, 0x00, 0x00 } },
+    { 1, { 0x33, 0x00, 0x00 } },
+    { 1, { 0x34, 0x00, 0x00 } },
+    { 1, { 0x35, 0x00, 0x00 } },
+    { 1, { 0x36, 0x00, 0x00 } },
+    { 1, { 0x37, 0x00, 0x00 } },
+    { 1, { 0x38, 0x00, 0x00 } },
+    { 1, { 0x39, 0x00, 0x00 } },
+    { 1, { 0x3A, 0x00, 0x00 } },
+    { 1, { 0x3B, 0x00, 0x00 } },
+    { 1, { 0x3C, 0x00, 0x00 } },
+    { 1, { 0x3D, 0x00, 0x00 } },
+    { 1, { 0x3E, 0x00, 0x00 } },
+    { 1, { 0x3F, 0x00, 0x00 } },
+    { 1, { 0x40, 0x00, 0x00 } },
+    { 1, { 0x41, 0x00, 0x00 } },
+    { 1, { 0x42, 0x00, 0x00 } },
+    { 1, { 0x43, 0x00, 0x00 } },
+    { 1, { 0x44, 0x00, 0x00 } },
+    { 1, { 0x45, 0x00, 0x00 } },
+    { 1, { 0x46, 0x00, 0x00 } },
+    { 1, { 0x47, 0x00, 0x00 } },
+    { 1, { 0x48, 0x00, 0x00 } },
+    { 1, { 0x49, 0x00, 0x00 } },
+    { 1, { 0x4A, 0x00, 0x00 } },
+    { 1, { 0x4B, 0x00, 0x00 } },
+    { 1, { 0x4C, 0x00, 0x00 } },
+    { 1, { 0x4D, 0x00, 0x00 } },
+    { 1, { 0x4E, 0x00, 0x00 } },
+    { 1, { 0x4F, 0x00, 0x00 } },
+    { 1, { 0x50, 0x00, 0x00 } },
+    { 1, { 0x51, 0x00, 0x00 } },
+    { 1, { 0x52, 0x00, 0x00 } },
+    { 1, { 0x53, 0x00, 0x00 } },
+    { 1, { 0x54, 0x00, 0x00 } },
+    { 1, { 0x55, 0x00, 0x00 } },
+    { 1, { 0x56, 0x00, 0x00 } },
+    { 1, { 0x57, 0x00, 0x00 } },
+    { 1, { 0x58, 0x00, 0x00 } },
+    { 1, { 0x59, 0x00, 0x00 } },
+    { 1, { 0x5A, 0x00, 0x00 } },
+    { 1, { 0x5B, 0x00, 0x00 } },
+    { 1, { 0x5C, 0x00, 0x00 } },
+    { 1, { 0x5D, 0x00, 0x00 } },
+    { 1, { 0x5E, 0x00, 0x00 } },
+    { 1, { 0x5F, 0x00, 0x00 } },
+    { 1, { 0x60, 0x00, 0x00 } },
+    { 1, { 0x61, 0x00, 0x00 } },
+    { 1, { 0x62, 0x00, 0x00 } },
+    { 1, { 0x63, 0x00, 0x00 } },
+    { 1, { 0x64, 0x00, 0x00 } },
+    { 1, { 0x65, 0x00, 0x00 } },
+    { 1, { 0x66, 0x00, 0x00 } },
+    { 1, { 0x67, 0x00, 0x00 } },
+    { 1, { 0x68, 0x00, 0x00 } },
+    { 1, { 0x69, 0x00, 0x00 } },
+    { 1, { 0x6A, 0x00, 0x00 } },
+    { 1, { 0x6B, 0x00, 0x00 } },
+    { 1, { 0x6C, 0x00, 0x00 } },
+    { 1, { 0x6D, 0x00, 0x00 } },
+    { 1, { 0x6E, 0x00, 0x00 } },
+    { 1, { 0x6F, 0x00, 0x00 } },
+    { 1, { 0x70, 0x00, 0x00 } },
+    { 1, { 0x71, 0x00, 0x00 } },
+    { 1, { 0x72, 0x00, 0x00 } },
+    { 1, { 0x73, 0x00, 0x00 } },
+    { 1, { 0x74, 0x00, 0x00 } },
+    { 1, { 0x75, 0x00, 0x00 } },
+    { 1, { 0x76, 0x00, 0x00 } },
+    { 1, { 0x77, 0x00, 0x00 } },
+    { 1, { 0x78, 0x00, 0x00 } },
+    { 1, { 0x79, 0x00, 0x00 } },
+    { 1, { 0x7A, 0x00, 0x00 } },
+    { 1, { 0x7B, 0x00, 0x00 } },
+    { 1, { 0x7C, 0x00, 0x00 } },
+    { 1, { 0x7D, 0x00, 0x00 } },
+    { 1, { 0x7E, 0x00, 0x00 } },
+    { 1, { 0x7F, 0x00, 0x00 } },
+    { 3, { 0xE2, 0x94, 0x80 } },
+    { 3, { 0xE2, 0x94, 0x82 } },
+    { 3, { 0xE2, 0x94, 0x8C } },
+    { 3, { 0xE2, 0x94, 0x90 } },
+    { 3, { 0xE2, 0x94, 0x94 } },
+    { 3, { 0xE2, 0x94, 0x98 } },
+    { 3, { 0xE2, 0x94, 0x9C } },
+    { 3, { 0xE2, 0x94, 0xA4 } },
+    { 3, { 0xE2, 0x94, 0xAC } },
+    { 3, { 0xE2, 0x94, 0xB4 } },
+    { 3, { 0xE2, 0x94, 0xBC } },
+    { 3, { 0xE2, 0x96, 0x80 } },
+    { 3, { 0xE2, 0x96, 0x84 } },
+    { 3, { 0xE2, 0x96, 0x88 } },
+    { 3, { 0xE2, 0x96, 0x8C } },
+    { 3, { 0xE2, 0x96, 0x90 } },
+    { 3, { 0xE2, 0x96, 0x91 } },
+    { 3, { 0xE2, 0x96, 0x92 } },
+    { 3, { 0xE2, 0x96, 0x93 } },
+    { 3, { 0xE2, 0x8C, 0xA0 } },
+    { 3, { 0xE2, 0x96, 0xA0 } },
+    { 3, { 0xE2, 0x88, 0x99 } },
+    { 3, { 0xE2, 0x88, 0x9A } },
+    { 3, { 0xE2, 0x89, 0x88 } },
+    { 3, { 0xE2, 0x89, 0xA4 } },
+    { 3, { 0xE2, 0x89, 0xA5 } },
+    { 2, { 0xC2, 0xA0, 0x00 } },
+    { 3, { 0xE2, 0x8C, 0xA1 } },
+    { 2, { 0xC2, 0xB0, 0x00 } },
+    { 2, { 0xC2, 0xB2, 0x00 } },
+    { 2, { 0xC2, 0xB7, 0x00 } },
+    { 2, { 0xC3, 0xB7, 0x00 } },
+    { 3, { 0xE2, 0x95, 0x90 } },
+    { 3, { 0xE2, 0x95, 0x91 } },
+    { 3, { 0xE2, 0x95, 0x92 } },
+    { 2, { 0xD1, 0x91, 0x00 } },
+    { 3, { 0xE2, 0x95, 0x93 } },
+    { 3, { 0xE2, 0x95, 0x94 } },
+    { 3, { 0xE2, 0x95, 0x95 } },
+    { 3, { 0xE2, 0x95, 0x96 } },
+    { 3, { 0xE2, 0x95, 0x97 } },
+    { 3, { 0xE2, 0x95, 0x98 } },
+    { 3, { 0xE2, 0x95, 0x99 } },
+    { 3, { 0xE2, 0x95, 0x9A } },
+    { 3, { 0xE2, 0x95, 0x9B } },
+    { 3, { 0xE2, 0x95, 0x9C } },
+    { 3, { 0xE2, 0x95, 0x9D } },
+    { 3, { 0xE2, 0x95, 0x9E } },
+    { 3, { 0xE2, 0x95, 0x9F } },
+    { 3, { 0xE2, 0x95, 0xA0 } },
+    { 3, { 0xE2, 0x95, 0xA1 } },
+    { 2, { 0xD0, 0x81, 0x00 } },
+    { 3, { 0xE2, 0x95, 0xA2 } },
+    { 3, { 0xE2, 0x95, 0xA3 } },
+    { 3, { 0xE2, 0x95, 0xA4 } },
+    { 3, { 0xE2, 0x95, 0xA5 } },
+    { 3, { 0xE2, 0x95, 0xA6 } },
+    { 3, { 0xE2, 0x95, 0xA7 } },
+    { 3, { 0xE2, 0x95, 0xA8 } },
+    { 3, { 0xE2, 0x95, 0xA9 } },
+    { 3, { 0xE2, 0x95, 0xAA } },
+    { 3, { 0xE2, 0x95, 0xAB } },
+    { 3, { 0xE2, 0x95, 0xAC } },
+    { 2, { 0xC2, 0xA9, 0x00 } },
+    { 2, { 0xD1, 0x8E, 0x00 } },
+    { 2, { 0xD0, 0xB0, 0x00 } },
+    { 2, { 0xD0, 0xB1, 0x00 } },
+    { 2, { 0xD1, 0x86, 0x00 } },
+    { 2, { 0xD0, 0xB4, 0x00 } },
+    { 2, { 0xD0, 0xB5, 0x00 } },
+    { 2, { 0xD1, 0x84, 0x00 } },
+    { 2, { 0xD0, 0xB3, 0x00 } },
+    { 2, { 0xD1, 0x85, 0x00 } },
+    { 2, { 0xD0, 0xB8, 0x00 } },
+    { 2, { 0xD0, 0xB9, 0x00 } },
+    { 2, { 0xD0, 0xBA, 0x00 } },
+    { 2, { 0xD0, 0xBB, 0x00 } },
+    { 2, { 0xD0, 0xBC, 0x00 } },
+    { 2, { 0xD0, 0xBD, 0x00 } },
+    { 2, { 0xD0, 0xBE, 0x00 } },
+    { 2, { 0xD0, 0xBF, 0x00 } },
+    { 2, { 0xD1, 0x8F, 0x00 } },
+    { 2, { 0xD1, 0x80, 0x00 } },
+    { 2, { 0xD1, 0x81, 0x00 } },
+    { 2, { 0xD1, 0x82, 0x00 } },
+    { 2, { 0xD1, 0x83, 0x00 } },
+    { 2, { 0xD0, 0xB6, 0x00 } },
+    { 2, { 0xD0, 0xB2, 0x00 } },
+    { 2, { 0xD1, 0x8C, 0x00 } },
+    { 2, { 0xD1, 0x8B, 0x00 } },
+    { 2, { 0xD0, 0xB7, 0x00 } },
+    { 2, { 0xD1, 0x88, 0x00 } },
+    { 2, { 0xD1, 0x8D, 0x00 } },
+    { 2, { 0xD1, 0x89, 0x00 } },
+    { 2, { 0xD1, 0x87, 0x00 } },
+    { 2, { 0xD1, 0x8A, 0x00 } },
+    { 2, { 0xD0, 0xAE, 0x00 } },
+    { 2, { 0xD0, 0x90, 0x00 } },
+    { 2, { 0xD0, 0x91, 0x00 } },
+    { 2, { 0xD0, 0xA6, 0x00 } },
+    { 2, { 0xD0, 0x94, 0x00 } },
+    { 2, { 0xD0, 0x95, 0x00 } },
+    { 2, { 0xD0, 0xA4, 0x00 } },
+    { 2, { 0xD0, 0x93, 0x00 } },
+    { 2, { 0xD0, 0xA5, 0x00 } },
+    { 2, { 0xD0, 0x98, 0x00 } },
+    { 2, { 0xD0, 0x99, 0x00 } },
+    { 2, { 0xD0, 0x9A, 0x00 } },
+    { 2, { 0xD0, 0x9B, 0x00 } },
+    { 2, { 0xD0, 0x9C, 0x00 } },
+    { 2, { 0xD0, 0x9D, 0x00 } },
+    { 2, { 0xD0, 0x9E, 0x00 } },
+    { 2, { 0xD0, 0x9F, 0x00 } },
+    { 2, { 0xD0, 0xAF, 0x00 } },
+    { 2, { 0xD0, 0xA0, 0x00 } },
+    { 2, { 0xD0, 0xA1, 0x00 } },
+    { 2, { 0xD0, 0xA2, 0x00 } },
+    { 2, { 0xD0, 0xA3, 0x00 } },
+    { 2, { 0xD0, 0x96, 0x00 } },
+    { 2, { 0xD0, 0x92, 0x00 } },
+    { 2, { 0xD0, 0xAC, 0x00 } },
+    { 2, { 0xD0, 0xAB, 0x00 } },
+    { 2, { 0xD0, 0x97, 0x00 } },
+    { 2, { 0xD0, 0xA8, 0x00 } },
+    { 2, { 0xD0, 0xAD, 0x00 } },
+    { 2, { 0xD0, 0xA9, 0x00 } },
+    { 2, { 0xD0, 0xA7, 0x00 } },
+    { 2, { 0xD0, 0xAA, 0x00 } },
+};
+
+static const unsigned char KOI8_R_flagged[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const SbcsCharset sbcs_charsets[] =
+{
+    { "ISO-8859-1", ISO_8859_1_map, ISO_8859_1_flagged },
+    { "ISO-8859-2", ISO_8859_2_map, ISO_8859_2_flagged },
+    { "ISO-8859-5", ISO_8859_5_map, ISO_8859_5_flagged },
+    { "ISO-8859-6", ISO_8859_6_map, ISO_8859_6_flagged },
+    { "ISO-8859-7", ISO_8859_7_map, ISO_8859_7_flagged },
+    { "ISO-8859-8", ISO_8859_8_map, ISO_8859_8_flagged },
+    { "ISO-8859-8-I", ISO_8859_8_I_map, ISO_8859_8_I_flagged },
+    { "ISO-8859-9", ISO_8859_9_map, ISO_8859_9_flagged },
+    { "windows-1250", windows_1250_map, windows_1250_flagged },
+    { "windows-1251", windows_1251_map, windows_1251_flagged },
+    { "windows-1252", windows_1252_map, windows_1252_flagged },
+    { "windows-1253", windows_1253_map, windows_1253_flagged },
+    { "windows-1254", windows_1254_map, windows_1254_flagged },
+    { "windows-1255", windows_1255_map, windows_1255_flagged },
+    { "windows-1256", windows_1256_map, windows_1256_flagged },
+    { "KOI8-R", KOI8_R_map, KOI8_R_flagged },
+    { NULL, NULL, NULL }
+};
@@ -0,0 +1,28 @@
+--
+-- statement trigger converting the rows of a load at once
+--
+\pset format unaligned
+
+CREATE TABLE batch_test (id int PRIMARY KEY, v text);
+CREATE TRIGGER convert_after_load AFTER INSERT ON batch_test
+    REFERENCING NEW TABLE AS new_rows
+    FOR EACH STATEMENT EXECUTE PROCEDURE pg_chardetect_convert_batch_trigger(v);
+INSERT INTO batch_test VALUES
+    (1, E'\x93first row\x94'),
+    (2, 'plain ascii'),
+    (3, E'caf\xe9 au lait');
+SELECT id, encode(convert_to(v, 'SQL_ASCII'), 'hex') AS v FROM batch_test ORDER BY id;
+
+-- more rows than one UPDATE writes back
+INSERT INTO batch_test SELECT g, 'bulk loaded ' || E'\x93row\x94 ' || g FROM generate_series(10, 10509) g;
+SELECT count(*) AS converted FROM batch_test
+ WHERE id >= 10 AND v = 'bulk loaded ' || E'\xe2\x80\x9crow\xe2\x80\x9d ' || id;
+
+-- rows are matched on the primary key or replica identity index
+CREATE TABLE batch_nokey_test (v text);
+CREATE TRIGGER convert_after_load AFTER INSERT ON batch_nokey_test
+    REFERENCING NEW TABLE AS new_rows
+    FOR EACH STATEMENT EXECUTE PROCEDURE pg_chardetect_convert_batch_trigger(v);
+INSERT INTO batch_nokey_test VALUES (E'\x93no key\x94');
+
+DROP TABLE batch_test, batch_nokey_test;
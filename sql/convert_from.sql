@@ -0,0 +1,30 @@
+--
+-- strict conversion from a given encoding
+--
+\pset format unaligned
+
+-- round trip: windows-1252 to UTF8 and back gives the original bytes
+SELECT converted,
+       text_out = E'win1252 \xe2\x80\x9ccurly quotes\xe2\x80\x9d' AS utf8,
+       convert(convert_to(text_out, 'SQL_ASCII'), 'UTF8', 'WIN1252')
+           = convert_to(E'win1252 \x93curly quotes\x94', 'SQL_ASCII') AS round_trip
+  FROM convert_to_UTF8(E'win1252 \x93curly quotes\x94', 'WIN1252');
+
+-- ICU names work as well as PostgreSQL ones
+SELECT encode(convert_to(text_out, 'SQL_ASCII'), 'hex') AS text_out, converted
+  FROM convert_to_UTF8(E'caf\xe9', 'ISO-8859-1');
+SELECT encode(convert_to(text_out, 'SQL_ASCII'), 'hex') AS text_out, converted
+  FROM convert_to_UTF8(E'caf\xe9', 'LATIN1');
+
+-- the same result as with detection
+SELECT converted, dropped_bytes,
+       text_out = E'win1252 \xe2\x80\x9ccurly quotes\xe2\x80\x9d' AS utf8
+  FROM convert_to_UTF8(E'win1252 \x93curly quotes\x94', true);
+
+-- a byte that is not valid in the given encoding returns the input
+SELECT encode(convert_to(text_out, 'SQL_ASCII'), 'hex') AS text_out, converted
+  FROM convert_to_UTF8(E'bad \xff', 'UTF8');
+
+-- so does an encoding ICU cannot convert from
+SELECT encode(convert_to(text_out, 'SQL_ASCII'), 'hex') AS text_out, converted
+  FROM convert_to_UTF8('abc', 'MULE_INTERNAL');
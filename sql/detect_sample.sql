@@ -0,0 +1,26 @@
+--
+-- detection from a bounded sample of the value
+--
+\pset format unaligned
+-- the native detector gives the same answer with every ICU version
+SET pg_chardetect.detector = native;
+
+-- only the first max_detect_bytes bytes are examined
+SELECT * FROM char_set_detect('plain ascii prefix ' || E'\x93tail\x94', 12);
+SELECT * FROM char_set_detect('plain ascii prefix ' || E'\x93tail\x94', 0);
+
+-- a TOASTed value is read in slices rather than detoasted in full
+CREATE TABLE detect_sample_test (v text);
+INSERT INTO detect_sample_test SELECT repeat('plain ascii ', 100000) || E'\x93tail\x94';
+SELECT d.* FROM detect_sample_test, char_set_detect(v, 1000) d;
+SELECT d.* FROM detect_sample_test, char_set_detect(v) d;
+SET pg_chardetect.max_detect_bytes = 1000;
+SELECT d.* FROM detect_sample_test, char_set_detect(v) d;
+SET pg_chardetect.detect_slices = 4;
+SET pg_chardetect.max_detect_bytes = 4096;
+SELECT d.* FROM detect_sample_test, char_set_detect(v) d;
+
+RESET pg_chardetect.max_detect_bytes;
+RESET pg_chardetect.detect_slices;
+RESET pg_chardetect.detector;
+DROP TABLE detect_sample_test;
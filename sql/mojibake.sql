@@ -0,0 +1,18 @@
+--
+-- double encoded UTF-8
+--
+\pset format unaligned
+
+-- "é" decoded as windows-1252 and encoded to UTF-8 again
+SELECT * FROM char_set_detect(E'caf\xc3\x83\xc2\xa9');
+SELECT * FROM char_set_detect(E'caf\xc3\xa9');
+SELECT * FROM char_set_detect_all(E'caf\xc3\x83\xc2\xa9');
+
+-- ICU candidates named UTF-8 are flagged as well
+SELECT encoding, mojibake
+  FROM char_set_detect_all(E'caf\xc3\x83\xc2\xa9 cr\xc3\x83\xc2\xa8me br\xc3\x83\xc2\xbbl\xc3\x83\xc2\xa9e, d\xc3\x83\xc2\xa9j\xc3\x83\xc2\xa0 vu \xff', 1);
+
+-- one pass per layer of double encoding; correct UTF-8 is kept
+SELECT encode(convert_to(repair_mojibake(E'caf\xc3\x83\xc2\xa9'), 'SQL_ASCII'), 'hex') AS repaired;
+SELECT encode(convert_to(repair_mojibake(E'caf\xc3\x83\xc2\x83\xc3\x82\xc2\xa9'), 'SQL_ASCII'), 'hex') AS repaired;
+SELECT encode(convert_to(repair_mojibake(E'caf\xc3\xa9 and caf\xc3\x83\xc2\xa9'), 'SQL_ASCII'), 'hex') AS repaired;
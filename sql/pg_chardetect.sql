@@ -0,0 +1,33 @@
+--
+-- pg_chardetect regression tests
+--
+-- The database is SQL_ASCII so text can hold the legacy bytes to convert.
+-- Values are shown in hex to keep the raw bytes out of this file.  This
+-- test installs the functions for the ones that follow.
+--
+SET client_min_messages = warning;
+\set ECHO none
+\i pg_chardetect.sql
+\set ECHO all
+RESET client_min_messages;
+\pset format unaligned
+
+-- row trigger: converts new values, skips columns an UPDATE did not change
+CREATE TABLE trigger_test (id int PRIMARY KEY, a text, b text);
+INSERT INTO trigger_test VALUES (1, E'\x93a\x94', E'\x93b\x94');
+CREATE TRIGGER convert_on_write BEFORE INSERT OR UPDATE ON trigger_test
+    FOR EACH ROW EXECUTE PROCEDURE pg_chardetect_convert_trigger(a, b);
+UPDATE trigger_test SET b = E'\x93new value\x94' WHERE id = 1;
+INSERT INTO trigger_test VALUES (2, E'\x93inserted\x94', 'ascii');
+SELECT id, encode(convert_to(a, 'SQL_ASCII'), 'hex') AS a, encode(convert_to(b, 'SQL_ASCII'), 'hex') AS b
+  FROM trigger_test ORDER BY id;
+
+-- only the listed columns are converted
+CREATE TABLE trigger_columns_test (id int PRIMARY KEY, a text, b text);
+CREATE TRIGGER convert_on_write BEFORE INSERT OR UPDATE ON trigger_columns_test
+    FOR EACH ROW EXECUTE PROCEDURE pg_chardetect_convert_trigger(b);
+INSERT INTO trigger_columns_test VALUES (1, E'\x93kept as is\x94', E'\x93converted\x94');
+SELECT id, encode(convert_to(a, 'SQL_ASCII'), 'hex') AS a, encode(convert_to(b, 'SQL_ASCII'), 'hex') AS b
+  FROM trigger_columns_test ORDER BY id;
+
+DROP TABLE trigger_test, trigger_columns_test;
@@ -44,6 +44,11 @@ CREATE TRIGGER force_conversion_on_insert BEFORE INSERT ON test FOR EACH ROW EXE
 
 CREATE TRIGGER force_conversion_on_update BEFORE UPDATE ON test FOR EACH ROW EXECUTE PROCEDURE force_conversion();
 
+-- the same in C, for the listed columns only; it leaves valid UTF8 alone and
+-- skips columns an UPDATE did not change, so it would not convert the
+-- in-place update below
+-- CREATE TRIGGER convert_on_write BEFORE INSERT OR UPDATE ON test FOR EACH ROW EXECUTE PROCEDURE pg_chardetect_convert_trigger(convert_this);
+
 --
 -- single step mode with expanded display and timing on
 --
@@ -0,0 +1,282 @@
+#include "utf8scan.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+Byte classification ahead of charset detection.
+
+Most text handed to pg_chardetect is plain ASCII or already valid UTF-8, and
+either can be recognized without ICU.  ASCII runs are skipped 16 or 32 bytes
+at a time with SSE2 or AVX2, picked at runtime from what the CPU supports,
+with a word-at-a-time scalar loop everywhere else.  Multibyte sequences are
+checked one at a time against the well-formed byte ranges of the Unicode
+standard (table 3-7): no overlongs, no surrogates, nothing above U+10FFFF.
+
+NUL bytes are never accepted, since PostgreSQL text cannot hold them.
+*/
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define USE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+typedef size_t (*ascii_prefix_fn)(const unsigned char* s, size_t len);
+
+static size_t ascii_prefix_scalar(const unsigned char* s, size_t len);
+static size_t ascii_prefix_choose(const unsigned char* s, size_t len);
+
+#ifdef USE_X86_SIMD
+static size_t ascii_prefix_sse2(const unsigned char* s, size_t len) __attribute__((target("sse2")));
+static size_t ascii_prefix_avx2(const unsigned char* s, size_t len) __attribute__((target("avx2")));
+#endif
+
+// resolved on first use
+static ascii_prefix_fn ascii_prefix_impl = ascii_prefix_choose;
+
+#define HIGH_BITS   UINT64_C(0x8080808080808080)
+#define LOW_BITS    UINT64_C(0x0101010101010101)
+
+static size_t
+ascii_prefix_scalar(const unsigned char* s, size_t len)
+{
+    size_t i = 0;
+
+    // eight bytes at a time: stop at any byte with the high bit set or zero
+    while (i + sizeof(uint64_t) <= len)
+    {
+        uint64_t w;
+
+        memcpy(&w, s + i, sizeof(w));
+        if ((w & HIGH_BITS) || ((w - LOW_BITS) & ~w & HIGH_BITS))
+            break;
+        i += sizeof(w);
+    }
+
+    while (i < len && s[i] != 0 && s[i] < 0x80)
+        i++;
+
+    return i;
+}
+
+#ifdef USE_X86_SIMD
+static size_t
+ascii_prefix_sse2(const unsigned char* s, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    while (i + 16 <= len)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+        // high bit set, or byte equal to zero
+        unsigned mask = (unsigned) _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero)));
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+        i += 16;
+    }
+
+    return i + ascii_prefix_scalar(s + i, len - i);
+}
+
+static size_t
+ascii_prefix_avx2(const unsigned char* s, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+
+    while (i + 32 <= len)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (s + i));
+        unsigned mask = (unsigned) _mm256_movemask_epi8(_mm256_or_si256(v, _mm256_cmpeq_epi8(v, zero)));
+
+        if (mask)
+            return i + __builtin_ctz(mask);
+        i += 32;
+    }
+
+    return i + ascii_prefix_scalar(s + i, len - i);
+}
+#endif
+
+static size_t
+ascii_prefix_choose(const unsigned char* s, size_t len)
+{
+#ifdef USE_X86_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        ascii_prefix_impl = ascii_prefix_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        ascii_prefix_impl = ascii_prefix_sse2;
+    else
+        ascii_prefix_impl = ascii_prefix_scalar;
+#else
+    ascii_prefix_impl = ascii_prefix_scalar;
+#endif
+
+    return ascii_prefix_impl(s, len);
+}
+
+size_t
+ascii_prefix_len(const char* buffer, size_t len)
+{
+    return ascii_prefix_impl((const unsigned char*) buffer, len);
+}
+
+size_t
+utf8_sequence_len(const char* buffer, size_t len)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    unsigned char c = s[0];
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+
+    if (c >= 0xC2 && c <= 0xDF)
+    {
+        if (len >= 2 && (s[1] & 0xC0) == 0x80)
+            return 2;
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        // no overlongs, no surrogates
+        if (c == 0xE0)
+            lo = 0xA0;
+        else if (c == 0xED)
+            hi = 0x9F;
+
+        if (len >= 3 && s[1] >= lo && s[1] <= hi && (s[2] & 0xC0) == 0x80)
+            return 3;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        // no overlongs, nothing above U+10FFFF
+        if (c == 0xF0)
+            lo = 0x90;
+        else if (c == 0xF4)
+            hi = 0x8F;
+
+        if (len >= 4 && s[1] >= lo && s[1] <= hi &&
+            (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80)
+            return 4;
+    }
+
+    return 0;
+}
+
+size_t
+utf8_valid_prefix(const char* buffer, size_t len, bool* is_ascii)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i = 0;
+    bool ascii = true;
+
+    for (;;)
+    {
+        size_t n;
+
+        i += ascii_prefix_impl(s + i, len - i);
+        if (i >= len)
+            break;
+
+        // validate multibyte sequences until the next ASCII byte
+        while (i < len && s[i] >= 0x80)
+        {
+            n = utf8_sequence_len(buffer + i, len - i);
+            if (0 == n)
+                goto done;
+
+            ascii = false;
+            i += n;
+        }
+
+        // NUL is the only byte below 0x80 the ASCII scan stops on
+        if (i < len && s[i] == 0)
+            break;
+    }
+
+done:
+    if (NULL != is_ascii)
+        *is_ascii = ascii;
+
+    return i;
+}
+
+ByteClass
+classify_bytes(const char* buffer, size_t len)
+{
+    bool ascii;
+
+    if (utf8_valid_prefix(buffer, len, &ascii) < len)
+        return BYTES_OTHER;
+
+    return ascii ? BYTES_ASCII : BYTES_UTF8;
+}
+
+size_t
+utf8_partial_head(const char* buffer, size_t len)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i = 0;
+
+    while (i < len && i < 3 && (s[i] & 0xC0) == 0x80)
+        i++;
+
+    return i;
+}
+
+size_t
+utf8_partial_tail(const char* buffer, size_t len)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i;
+
+    // look back for the lead byte of the last sequence
+    for (i = 1; i <= 3 && i <= len; i++)
+    {
+        unsigned char c = s[len - i];
+        size_t need;
+
+        if ((c & 0xC0) == 0x80)
+            continue;
+
+        if (c >= 0xF0)
+            need = 4;
+        else if (c >= 0xE0)
+            need = 3;
+        else if (c >= 0xC0)
+            need = 2;
+        else
+            need = 1;
+
+        return (need > i) ? i : 0;
+    }
+
+    return 0;
+}
+
+bool
+utf8_all_below(const char* buffer, size_t len, unsigned int limit)
+{
+    const unsigned char* s = (const unsigned char*) buffer;
+    size_t i = 0;
+
+    while (i < len)
+    {
+        i += ascii_prefix_len(buffer + i, len - i);
+
+        if (i == len)
+            break;
+
+        // three and four byte sequences are U+0800 and up
+        if (s[i] >= 0xE0 || i + 1 == len)
+            return false;
+
+        if ((((unsigned int) (s[i] & 0x1F) << 6) | (s[i + 1] & 0x3F)) >= limit)
+            return false;
+
+        i += 2;
+    }
+
+    return true;
+}
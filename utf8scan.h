@@ -0,0 +1,38 @@
+#ifndef _UTF8SCAN
+#define _UTF8SCAN
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// byte classes reported by classify_bytes()
+typedef enum
+{
+    BYTES_ASCII,    // 0x01-0x7F only
+    BYTES_UTF8,     // strictly valid UTF-8 with at least one multibyte sequence
+    BYTES_OTHER     // anything else, including NUL bytes
+} ByteClass;
+
+// length of the leading run of 0x01-0x7F bytes
+size_t ascii_prefix_len(const char* buffer, size_t len);
+
+// length of the leading run of complete, strictly valid UTF-8 sequences;
+// is_ascii is set if that run contains no multibyte sequence
+size_t utf8_valid_prefix(const char* buffer, size_t len, bool* is_ascii);
+
+// length of the well-formed multibyte sequence at the start of buffer,
+// 0 if there is none
+size_t utf8_sequence_len(const char* buffer, size_t len);
+
+// classify buffer as pure ASCII, valid UTF-8 or neither
+ByteClass classify_bytes(const char* buffer, size_t len);
+
+// true if every character of valid UTF-8 buffer is below code point limit,
+// which must be at most U+0800
+bool utf8_all_below(const char* buffer, size_t len, unsigned int limit);
+
+// bytes of a sequence cut off at the start (continuation bytes, at most 3)
+// or at the end (an incomplete multibyte sequence) of a slice of text
+size_t utf8_partial_head(const char* buffer, size_t len);
+size_t utf8_partial_tail(const char* buffer, size_t len);
+
+#endif